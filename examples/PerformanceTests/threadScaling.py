@@ -0,0 +1,116 @@
+#! /usr/bin/env python
+# usage:  python this-script -executable executableName -input inputFile
+#                            [-threads N] [-efficiency E] [-verbose]
+#                            [-mpiexec mpiexec -mpinpf flag -procs P]
+#  errors will be in:  threadScaling.log
+#
+# Runs the problem with one and with N Kokkos threads and checks the speedup
+# of the residual and Jacobian fills, which are the parts that run as
+# threaded kernels in a Kokkos OpenMP build. The test fails if the speedup
+# is below E*N (default E = 0.5). With -mpiexec both runs use P processes,
+# e.g. for a mesh that is already partitioned into P parts.
+
+import sys
+import os
+from subprocess import Popen, PIPE
+
+base_name = "threadScaling"
+
+fill_timers = ["> Albany Fill: Residual", "> Albany Fill: Jacobian"]
+
+def fill_time(out):
+    """Sums the times of the fill timers in the Teuchos timer summary."""
+
+    total = 0.0
+    for line in out.splitlines():
+        for timer in fill_timers:
+            # skip timers that extend the name, e.g. "Jacobian Export"
+            if line.strip().startswith(timer + " "):
+                try:
+                    total += float(line.strip()[len(timer):].split()[0])
+                except ValueError:
+                    pass
+    return total
+
+def run(launcher, executable_name, input_file_name, num_threads, logfile):
+    """Runs Albany with num_threads threads and returns the fill time."""
+
+    command = launcher + [executable_name, input_file_name, "--kokkos-threads=" + str(num_threads)]
+    logfile.write("\n**** Running " + " ".join(command) + "\n")
+
+    p = Popen(command, stdout=PIPE, universal_newlines=True)
+    out, err = p.communicate()
+    if out != None:
+        logfile.write(out)
+    if err != None:
+        logfile.write(err)
+    logfile.flush()
+    if p.returncode != 0:
+        logfile.write("\n**** Error, run with " + str(num_threads) + " threads failed\n")
+        return None
+    return fill_time(out)
+
+if __name__ == "__main__":
+
+    result = 0
+
+    # open log file
+    log_file_name = base_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    # log file will be dumped if verbose option is given
+    verbose = False
+    if "-verbose" in sys.argv:
+        verbose = True
+
+    executable_name = None
+    if "-executable" in sys.argv:
+        executable_name = sys.argv[sys.argv.index("-executable") + 1]
+    input_file_name = None
+    if "-input" in sys.argv:
+        input_file_name = sys.argv[sys.argv.index("-input") + 1]
+    num_threads = 4
+    if "-threads" in sys.argv:
+        num_threads = int(sys.argv[sys.argv.index("-threads") + 1])
+    efficiency = 0.5
+    if "-efficiency" in sys.argv:
+        efficiency = float(sys.argv[sys.argv.index("-efficiency") + 1])
+    launcher = []
+    if "-mpiexec" in sys.argv:
+        launcher = [sys.argv[sys.argv.index("-mpiexec") + 1],
+                    sys.argv[sys.argv.index("-mpinpf") + 1],
+                    sys.argv[sys.argv.index("-procs") + 1]]
+
+    if executable_name == None or input_file_name == None:
+        logfile.write("\n**** Error, -executable and -input arguments required\n")
+        result = 1
+    else:
+        serial_time = run(launcher, executable_name, input_file_name, 1, logfile)
+        threaded_time = run(launcher, executable_name, input_file_name, num_threads, logfile)
+
+        if serial_time == None or threaded_time == None:
+            result = 1
+        elif serial_time <= 0.0 or threaded_time <= 0.0:
+            logfile.write("\n**** Error, fill timers not found in the output\n")
+            result = 1
+        else:
+            speedup = serial_time / threaded_time
+            if speedup < efficiency * num_threads:
+                result = 1
+                logfile.write("\n**** THREAD SCALING TEST FAILED:  fill speedup below the required value.")
+            else:
+                logfile.write("\n**** THREAD SCALING TEST PASSED:  fill speedup reached the required value.")
+            logfile.write("\n****                           fill time, 1 thread   = " + str(serial_time))
+            logfile.write("\n****                           fill time, " + str(num_threads) + " threads  = " + str(threaded_time))
+            logfile.write("\n****                           speedup               = " + str(speedup))
+            logfile.write("\n****                           required speedup      = " + str(efficiency * num_threads) + "\n")
+    logfile.flush()
+    logfile.close()
+
+    # dump the output if the user requested verbose
+    if verbose == True:
+        os.system("cat " + log_file_name)
+
+    sys.exit(result)
@@ -0,0 +1,199 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Teuchos_TestForException.hpp"
+
+#include "ActiveRegion.hpp"
+
+
+namespace AMP
+{
+  namespace
+  {
+    // squared distance from point (px,py) to the segment s = (x1,y1,x2,y2)
+    RealType segmentPointDistance2(const RealType* s, RealType px, RealType py)
+    {
+      const RealType dx = s[2] - s[0], dy = s[3] - s[1];
+      const RealType len2 = dx*dx + dy*dy;
+      RealType q = 0.0;
+      if (len2 > 0.0)
+        q = std::min(1.0, std::max(0.0, ((px - s[0])*dx + (py - s[1])*dy) / len2));
+      const RealType ex = s[0] + q*dx - px, ey = s[1] + q*dy - py;
+      return ex*ex + ey*ey;
+    }
+
+    // squared distance from point (px,py) to the box (x_min,y_min,x_max,y_max)
+    RealType boxPointDistance2(const RealType* b, RealType px, RealType py)
+    {
+      const RealType ex = std::max(0.0, std::max(b[0] - px, px - b[2]));
+      const RealType ey = std::max(0.0, std::max(b[1] - py, py - b[3]));
+      return ex*ex + ey*ey;
+    }
+
+    // true if the segment crosses the box (Liang-Barsky clipping)
+    bool segmentCrossesBox(const RealType* s, const RealType* b)
+    {
+      const RealType d[2] = {s[2] - s[0], s[3] - s[1]};
+      RealType t0 = 0.0, t1 = 1.0;
+      for (int i = 0; i < 2; ++i) {
+        if (d[i] == 0.0) {
+          if (s[i] < b[i] || s[i] > b[i+2]) return false;
+          continue;
+        }
+        RealType ta = (b[i] - s[i]) / d[i], tb = (b[i+2] - s[i]) / d[i];
+        if (ta > tb) std::swap(ta, tb);
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+        if (t0 > t1) return false;
+      }
+      return true;
+    }
+
+    // position of the laser at time t, with t inside the data range
+    void interpolate(const Teuchos::Array<LaserCenter>& data, RealType t,
+                     RealType& x, RealType& y)
+    {
+      LaserCenter val;
+      val.t = t;
+      Teuchos::Array<LaserCenter>::const_iterator hi =
+        std::lower_bound(data.begin(), data.end(), val, compLaserCenter);
+      if (hi == data.begin()) { x = hi->x; y = hi->y; return; }
+      Teuchos::Array<LaserCenter>::const_iterator lo = hi - 1;
+      const RealType q = (hi->t > lo->t) ? (t - lo->t) / (hi->t - lo->t) : 1.0;
+      x = (1.0 - q)*lo->x + q*hi->x;
+      y = (1.0 - q)*lo->y + q*hi->y;
+    }
+  }
+
+  ActiveRegion::ActiveRegion(const Teuchos::ParameterList& p) :
+    path_time_(0.0), have_path_(false)
+  {
+    radius_ = p.get<double>("Radius");
+    look_ahead_ = p.get<double>("Look Ahead Time", 0.0);
+    trailing_ = p.get<double>("Trailing Time", 0.0);
+
+    TEUCHOS_TEST_FOR_EXCEPTION(radius_ <= 0.0 || look_ahead_ < 0.0 || trailing_ < 0.0,
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl << "Active Region Error: Radius must be positive and times non-negative" << std::endl);
+  }
+
+  Teuchos::RCP<const Teuchos::ParameterList> ActiveRegion::getValidParameters()
+  {
+    Teuchos::RCP<Teuchos::ParameterList> valid_pl =
+      Teuchos::rcp(new Teuchos::ParameterList("Valid Active Region Params"));
+
+    valid_pl->set<double>("Radius", 1.0,
+        "Distance from the laser path within which worksets are active");
+    valid_pl->set<double>("Look Ahead Time", 0.0,
+        "Path ahead of the current time that activates worksets");
+    valid_pl->set<double>("Trailing Time", 0.0,
+        "Path behind the current time that keeps worksets active");
+
+    return valid_pl;
+  }
+
+  bool ActiveRegion::isActive(const PHAL::Workset& workset)
+  {
+    const unsigned int ws = workset.wsIndex;
+    if (ws >= active_.size()) {
+      boxes_.resize(4*(ws + 1));
+      eval_time_.resize(ws + 1, 0.0);
+      active_.resize(ws + 1, -1);
+    }
+
+    // the cells of a workset change with adaptation or repartitioning, so
+    // the box is recomputed rather than kept
+    RealType box[4];
+    computeBoundingBox(workset, box);
+    RealType* cached_box = &boxes_[4*ws];
+
+    const RealType t = workset.current_time;
+    if (active_[ws] >= 0 && eval_time_[ws] == t &&
+        std::equal(box, box + 4, cached_box))
+      return active_[ws];
+
+    if (!have_path_ || path_time_ != t)
+      computePath(t);
+
+    std::copy(box, box + 4, cached_box);
+    eval_time_[ws] = t;
+    active_[ws] = distanceToPath(box) <= radius_;
+    return active_[ws];
+  }
+
+  void ActiveRegion::computeBoundingBox(const PHAL::Workset& workset, RealType* box)
+  {
+    box[0] = box[1] = std::numeric_limits<RealType>::max();
+    box[2] = box[3] = -std::numeric_limits<RealType>::max();
+
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+      for (std::size_t node = 0; node < workset.wsCoords[cell].size(); ++node) {
+        const double* X = workset.wsCoords[cell][node];
+        box[0] = std::min(box[0], X[0]);
+        box[1] = std::min(box[1], X[1]);
+        box[2] = std::max(box[2], X[0]);
+        box[3] = std::max(box[3], X[1]);
+      }
+    }
+  }
+
+  void ActiveRegion::computePath(RealType t)
+  {
+    const Teuchos::Array<LaserCenter>& data = LaserData_.getLaserData();
+    path_.clear();
+    path_time_ = t;
+    have_path_ = true;
+    if (data.size() == 0) return;
+
+    const RealType t0 = std::max(t - trailing_, data.front().t);
+    const RealType t1 = std::min(t + look_ahead_, data.back().t);
+    if (t0 > t1) return;
+
+    // breakpoints of the path inside [t0, t1]
+    std::vector<RealType> times(1, t0);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      if (data[i].t > t0 && data[i].t < t1) times.push_back(data[i].t);
+    times.push_back(t1);
+
+    for (std::size_t i = 0; i + 1 < times.size(); ++i) {
+      // a segment is powered if the laser is on at both of its data points
+      const RealType tm = 0.5*(times[i] + times[i+1]);
+      LaserCenter val;
+      val.t = tm;
+      Teuchos::Array<LaserCenter>::const_iterator hi =
+        std::lower_bound(data.begin(), data.end(), val, compLaserCenter);
+      if (hi == data.end()) --hi;
+      Teuchos::Array<LaserCenter>::const_iterator lo = (hi == data.begin()) ? hi : hi - 1;
+      if (lo->power != 1 || hi->power != 1) continue;
+
+      RealType s[4];
+      interpolate(data, times[i], s[0], s[1]);
+      interpolate(data, times[i+1], s[2], s[3]);
+      path_.insert(path_.end(), s, s + 4);
+    }
+  }
+
+  RealType ActiveRegion::distanceToPath(const RealType* box) const
+  {
+    RealType d2 = std::numeric_limits<RealType>::max();
+    for (std::size_t i = 0; i < path_.size(); i += 4) {
+      const RealType* s = &path_[i];
+      if (segmentCrossesBox(s, box)) return 0.0;
+      d2 = std::min(d2, boxPointDistance2(box, s[0], s[1]));
+      d2 = std::min(d2, boxPointDistance2(box, s[2], s[3]));
+      d2 = std::min(d2, segmentPointDistance2(s, box[0], box[1]));
+      d2 = std::min(d2, segmentPointDistance2(s, box[2], box[1]));
+      d2 = std::min(d2, segmentPointDistance2(s, box[0], box[3]));
+      d2 = std::min(d2, segmentPointDistance2(s, box[2], box[3]));
+    }
+    return std::sqrt(d2);
+  }
+
+}
@@ -0,0 +1,69 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef _AMP_ACTIVEREGION_HPP_
+#define _AMP_ACTIVEREGION_HPP_
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "PHAL_Workset.hpp"
+
+#include "Laser.hpp"
+
+namespace AMP
+{
+  ///
+  /// \brief Moving window around the laser path
+  ///
+  /// A workset is active at time t if the powered part of the laser path
+  /// between t - "Trailing Time" and t + "Look Ahead Time" passes within
+  /// "Radius" of the (x,y) bounding box of its elements. The path is read
+  /// from LaserCenter.txt, so worksets rejoin the active set before the
+  /// laser reaches them. The bounding box is taken from the coordinates of
+  /// the workset on every call, so decisions follow the mesh through
+  /// adaptation and rebalancing; a decision is reused only for the same time
+  /// and box. The evaluators of the phase problem use it to
+  /// freeze Phi and Psi at their old values and drop the laser source in
+  /// inactive worksets, where the energy rate reduces to its sensible heat
+  /// term. "Radius" should therefore be larger than the melt pool.
+  ///
+  class ActiveRegion
+  {
+  public:
+    ActiveRegion(const Teuchos::ParameterList& p);
+
+    // true if the workset is in the window at workset.current_time
+    bool isActive(const PHAL::Workset& workset);
+
+    static Teuchos::RCP<const Teuchos::ParameterList> getValidParameters();
+
+  private:
+    static void computeBoundingBox(const PHAL::Workset& workset, RealType* box);
+    void computePath(RealType t);
+    RealType distanceToPath(const RealType* box) const;
+
+    RealType radius_;
+    RealType look_ahead_;
+    RealType trailing_;
+
+    Laser LaserData_;
+
+    // per workset: x_min, y_min, x_max, y_max, time of the last decision
+    // and the decision
+    std::vector<RealType> boxes_;
+    std::vector<RealType> eval_time_;
+    std::vector<signed char> active_;
+
+    // powered path segments in the window of path_time_, as
+    // x1, y1, x2, y2 quadruples
+    RealType path_time_;
+    bool have_path_;
+    std::vector<RealType> path_;
+  };
+}
+
+#endif
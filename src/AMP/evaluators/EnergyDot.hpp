@@ -13,6 +13,8 @@
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
 
+#include "ActiveRegion.hpp"
+
 namespace AMP {
 ///
 /// \brief  Rate of energy evaluator
@@ -84,6 +86,9 @@ private:
   // variable use to decide if consolidation must be computed
   bool hasConsolidation_;
 
+  // moving window around the laser path; null if every workset is active
+  Teuchos::RCP<ActiveRegion> active_region_;
+
   Teuchos::RCP<const Teuchos::ParameterList>
     getValidEnergyDotParameters() const;
 };
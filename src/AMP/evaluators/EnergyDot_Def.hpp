@@ -107,6 +107,9 @@ namespace AMP {
         cond_list = p.get<Teuchos::ParameterList*>("Porosity Parameter List");
         Initial_porosity = cond_list->get("Value", 0.0);
 
+        if (p.isParameter("Active Region"))
+          active_region_ = p.get<Teuchos::RCP<ActiveRegion> >("Active Region");
+
 
         this->setName("EnergyDot" + PHX::typeAsString<EvalT>());
 
@@ -167,71 +170,86 @@ evaluateFields(typename Traits::EvalData workset)
     // Variable used to compute p = phi^3 * (10-15*phi+6*phi^2)
     ScalarT p;
 
-    if (hasConsolidation_) {
-
-    		for (std::size_t cell = 0; cell < workset.numCells; ++cell)
-    		{
-        	for (std::size_t qp = 0; qp < num_qps_; ++qp)
-        	{
-
-            	// compute dT/dt using finite difference
-            	T_dot_(cell, qp) = (T_(cell, qp) - T_old(cell, qp)) / dt;
-
-            	// compute dp/dphi
-            	phi = phi_(cell, qp);
-            	dpdphi = 30.0 * phi * phi * (1.0 - 2.0 * phi + phi * phi);
-
-            	// compute phi_dot
-            	//phi_dot = (1.0 / (2.0 * Tc_)) * std::pow(std::cosh((T_(cell, qp) - Tm_) / Tc_), -2.0) * T_dot_(cell, qp);
-            	phi_dot_(cell,qp) = ( phi_(cell,qp) - phi_old(cell,qp) ) / dt;
-
-            	// compute psi_dot
-            	psi_dot_(cell,qp) = ( psi_(cell,qp) - psi_old(cell,qp) ) / dt;
-		
-
-            	// compute energy dot
-            	Cs = rho_Cp_(cell, qp);
-
-            	// p
-            	p = phi * phi * phi * (10.0 - 15.0 * phi + 6.0 * phi * phi);
-            	energyDot_(cell, qp) = (Cs + p * (Cl_ - Cs)) * T_dot_(cell, qp) +
-              	dpdphi * (L_ + (Cl_ - Cs) * (T_(cell, qp) - Tm_)) * phi_dot_(cell,qp) -
-                	(p*(T_(cell,qp) - Tm_) - T_(cell,qp))*Cd*Initial_porosity*psi_dot_(cell,qp);
-
-        	} //end for loop
-    		} //end for loop
+    if (!active_region_.is_null() && !active_region_->isActive(workset)) {
+
+        // outside the active region phi and psi are frozen, which leaves
+        // the sensible heat term only
+        for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+        {
+            for (std::size_t qp = 0; qp < num_qps_; ++qp)
+            {
+                T_dot_(cell, qp) = (T_(cell, qp) - T_old(cell, qp)) / dt;
+                phi_dot_(cell,qp) = 0.0;
+                psi_dot_(cell,qp) = 0.0;
+
+                phi = phi_(cell, qp);
+                Cs = rho_Cp_(cell, qp);
+                p = phi * phi * phi * (10.0 - 15.0 * phi + 6.0 * phi * phi);
+                energyDot_(cell, qp) = (Cs + p * (Cl_ - Cs)) * T_dot_(cell, qp);
+            }
+        }
+    } else if (hasConsolidation_) {
+
+        for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+        {
+            for (std::size_t qp = 0; qp < num_qps_; ++qp)
+            {
+
+                // compute dT/dt using finite difference
+                T_dot_(cell, qp) = (T_(cell, qp) - T_old(cell, qp)) / dt;
+
+                // compute dp/dphi
+                phi = phi_(cell, qp);
+                dpdphi = 30.0 * phi * phi * (1.0 - 2.0 * phi + phi * phi);
+
+                // compute phi_dot
+                //phi_dot = (1.0 / (2.0 * Tc_)) * std::pow(std::cosh((T_(cell, qp) - Tm_) / Tc_), -2.0) * T_dot_(cell, qp);
+                phi_dot_(cell,qp) = ( phi_(cell,qp) - phi_old(cell,qp) ) / dt;
+
+                // compute psi_dot
+                psi_dot_(cell,qp) = ( psi_(cell,qp) - psi_old(cell,qp) ) / dt;
+
+                // compute energy dot
+                Cs = rho_Cp_(cell, qp);
+
+                // p
+                p = phi * phi * phi * (10.0 - 15.0 * phi + 6.0 * phi * phi);
+                energyDot_(cell, qp) = (Cs + p * (Cl_ - Cs)) * T_dot_(cell, qp) +
+                    dpdphi * (L_ + (Cl_ - Cs) * (T_(cell, qp) - Tm_)) * phi_dot_(cell,qp) -
+                    (p*(T_(cell,qp) - Tm_) - T_(cell,qp))*Cd*Initial_porosity*psi_dot_(cell,qp);
+
+            } //end for loop
+        } //end for loop
     } else {
 
-		for (std::size_t cell = 0; cell < workset.numCells; ++cell)
-    		{
-        	for (std::size_t qp = 0; qp < num_qps_; ++qp)
-        	{
+        for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+        {
+            for (std::size_t qp = 0; qp < num_qps_; ++qp)
+            {
 
-            	// compute dT/dt using finite difference
-            	T_dot_(cell, qp) = (T_(cell, qp) - T_old(cell, qp)) / dt;
+                // compute dT/dt using finite difference
+                T_dot_(cell, qp) = (T_(cell, qp) - T_old(cell, qp)) / dt;
 
-            	// compute dp/dphi
-            	phi = phi_(cell, qp);
-            	dpdphi = 30.0 * phi * phi * (1.0 - 2.0 * phi + phi * phi);
+                // compute dp/dphi
+                phi = phi_(cell, qp);
+                dpdphi = 30.0 * phi * phi * (1.0 - 2.0 * phi + phi * phi);
 
-            	// compute phi_dot
-            	//phi_dot = (1.0 / (2.0 * Tc_)) * std::pow(std::cosh((T_(cell, qp) - Tm_) / Tc_), -2.0) * T_dot_(cell, qp);
-            	phi_dot_(cell,qp) = ( phi_(cell,qp) - phi_old(cell,qp) ) / dt;
+                // compute phi_dot
+                //phi_dot = (1.0 / (2.0 * Tc_)) * std::pow(std::cosh((T_(cell, qp) - Tm_) / Tc_), -2.0) * T_dot_(cell, qp);
+                phi_dot_(cell,qp) = ( phi_(cell,qp) - phi_old(cell,qp) ) / dt;
 
-		
-            	// compute energy dot
-            	Cs = rho_Cp_(cell, qp);
+                // compute energy dot
+                Cs = rho_Cp_(cell, qp);
 
-            	// p
-            	p = phi * phi * phi * (10.0 - 15.0 * phi + 6.0 * phi * phi);
-            	energyDot_(cell, qp) = (Cs + p * (Cl_ - Cs)) * T_dot_(cell, qp) +
-              	dpdphi * (L_ + (Cl_ - Cs) * (T_(cell, qp) - Tm_)) * phi_dot_(cell,qp);
-		
-        	} //end for loop
-    		} //end for loop
+                // p
+                p = phi * phi * phi * (10.0 - 15.0 * phi + 6.0 * phi * phi);
+                energyDot_(cell, qp) = (Cs + p * (Cl_ - Cs)) * T_dot_(cell, qp) +
+                    dpdphi * (L_ + (Cl_ - Cs) * (T_(cell, qp) - Tm_)) * phi_dot_(cell,qp);
 
+            } //end for loop
+        } //end for loop
 
-     } //end if loop
+    } //end if loop
 }
 
 
@@ -18,6 +18,7 @@
 #include "Albany_Layouts.hpp"
 
 #include "Laser.hpp"
+#include "ActiveRegion.hpp"
 
 namespace AMP {
 ///
@@ -73,6 +74,9 @@ private:
 
   Laser LaserData_;
 
+  // moving window around the laser path; null if every workset is active
+  Teuchos::RCP<ActiveRegion> active_region_;
+
   Teuchos::RCP<const Teuchos::ParameterList>
      getValidLaserSourceParameters() const;
 };
@@ -72,6 +72,9 @@ LaserSource(Teuchos::ParameterList& p,
   ScalarT value_powder_hemispherical_reflectivity = cond_list->get("Powder Hemispherical Reflectivity Value", 1.0);
   init_constant_powder_hemispherical_reflectivity(value_powder_hemispherical_reflectivity,p);
 
+  if (p.isParameter("Active Region"))
+    active_region_ = p.get<Teuchos::RCP<ActiveRegion> >("Active Region");
+
   this->setName("LaserSource"+PHX::typeAsString<EvalT>());
 
 }
@@ -124,6 +127,14 @@ template<typename EvalT, typename Traits>
 void LaserSource<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  // no laser heating outside the active region
+  if (!active_region_.is_null() && !active_region_->isActive(workset)) {
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+      for (std::size_t qp = 0; qp < num_qps_; ++qp)
+        laser_source_(cell,qp) = 0.0;
+    return;
+  }
+
   // current time
  const RealType t = workset.current_time;
   
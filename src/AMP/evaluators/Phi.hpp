@@ -17,6 +17,8 @@
 #include "Teuchos_Array.hpp"
 #include "Albany_Layouts.hpp"
 
+#include "ActiveRegion.hpp"
+
 namespace AMP {
 /// \brief  Phi: This evaluator computes the Phi State Variables to a phase-change/heat equation problem
 
@@ -55,6 +57,10 @@ private:
   unsigned int workset_size_;
 
   bool enable_transient_;
+  std::string phi_old_name_;
+
+  // moving window around the laser path; null if every workset is active
+  Teuchos::RCP<ActiveRegion> active_region_;
 
   Teuchos::RCP<const Teuchos::ParameterList>
 	getValidPhiParameters() const;
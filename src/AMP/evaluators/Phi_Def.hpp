@@ -52,6 +52,11 @@ Phi(Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl) :
   type = cond_list->get("delta Temperature Type", "Constant");
   deltaTemperature_ = cond_list->get("delta Temperature Value", 50.0); 
 
+  phi_old_name_ = p.get<std::string>("Phi Name")+"_old";
+
+  if (p.isParameter("Active Region"))
+    active_region_ = p.get<Teuchos::RCP<ActiveRegion> >("Active Region");
+
   this->setName("Phi"+PHX::typeAsString<EvalT>());
 }
 
@@ -78,7 +83,20 @@ evaluateFields(typename Traits::EvalData workset)
     // current time
     const RealType t = workset.current_time;
 
-    if (t > 0.0)
+    // outside the active region phi keeps its old value
+    if (t > 0.0 && !active_region_.is_null() && !active_region_->isActive(workset))
+    {
+        // one lookup per workset; the arrays are rebuilt when the mesh
+        // changes, so they are not kept between evaluations
+        Albany::StateArray::const_iterator it = workset.stateArrayPtr->find(phi_old_name_);
+        TEUCHOS_TEST_FOR_EXCEPTION(it == workset.stateArrayPtr->end(), std::logic_error,
+            std::endl << "Phi Error: state " << phi_old_name_ << " not found" << std::endl);
+        const Albany::MDArray& phi_old = it->second;
+        for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+            for (std::size_t qp = 0; qp < num_qps_; ++qp)
+                phi_(cell, qp) = phi_old(cell, qp);
+    }
+    else if (t > 0.0)
     {
         // defining phi. Note that phi = 0 if T < Tm and phi = 1 if T > Tm
         for (std::size_t cell = 0; cell < workset.numCells; ++cell)
@@ -17,6 +17,8 @@
 #include "Teuchos_Array.hpp"
 #include "Albany_Layouts.hpp"
 
+#include "ActiveRegion.hpp"
+
 namespace AMP {
 ///
 /// \brief  Psi
@@ -63,6 +65,9 @@ private:
   unsigned int workset_size_;
 
   bool enable_transient_;
+
+  // moving window around the laser path; null if every workset is active
+  Teuchos::RCP<ActiveRegion> active_region_;
   std::string psi_Name_;
   std::string phi_Name_;
   
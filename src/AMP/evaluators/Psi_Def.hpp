@@ -54,6 +54,9 @@ Psi(Teuchos::ParameterList& p,
 
   psi_Name_ = p.get<std::string>("Psi Name")+"_old";
   phi_Name_ = p.get<std::string>("Phi Name")+"_old";
+
+  if (p.isParameter("Active Region"))
+    active_region_ = p.get<Teuchos::RCP<ActiveRegion> >("Active Region");
   this->setName("Psi"+PHX::typeAsString<EvalT>());
 }
 
@@ -97,6 +100,13 @@ evaluateFields(typename Traits::EvalData workset)
             }
         }
     }
+    else if (!active_region_.is_null() && !active_region_->isActive(workset))
+    {
+        // outside the active region psi keeps its old value
+        for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+            for (std::size_t qp = 0; qp < num_qps_; ++qp)
+                psi_(cell, qp) = psi_old(cell, qp);
+    }
     else
     {
         // defining psi_
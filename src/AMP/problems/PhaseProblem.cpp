@@ -36,7 +36,14 @@ PhaseProblem(const Teuchos::RCP<Teuchos::ParameterList>& params_,
       *out << "*******************************" << std::endl;
   }
   
-  
+  // Evaluate phase change and laser heating only near the laser path
+  if (params->isSublist("Active Region")) {
+    active_region_ = Teuchos::rcp(
+        new AMP::ActiveRegion(params->sublist("Active Region")));
+    *out << "Active region radius: "
+         << params->sublist("Active Region").get<double>("Radius") << std::endl;
+  }
+
   this->setNumEquations(1);
 }
 
@@ -159,6 +166,10 @@ Albany::PhaseProblem::getValidProblemParameters() const
                             "materials.xml",
                             "Filename of material database xml file");
 
+  validPL->sublist("Active Region", false,
+                   "Moving window around the laser path").setParameters(
+                       *AMP::ActiveRegion::getValidParameters());
+
   return validPL;
 }
 
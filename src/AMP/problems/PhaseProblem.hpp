@@ -19,6 +19,7 @@
 #include "Albany_ProblemUtils.hpp"
 #include "Albany_StateManager.hpp"
 #include "QCAD_MaterialDatabase.hpp"
+#include "ActiveRegion.hpp"
 
 namespace Albany {
 
@@ -94,6 +95,10 @@ protected:
   // or not in the model. It may be removed in the future.
   bool hasConsolidation_;
 
+  // optional moving window around the laser path outside of which phase
+  // change and laser heating are not evaluated
+  Teuchos::RCP<AMP::ActiveRegion> active_region_;
+
   Teuchos::RCP<Albany::Layouts> dl_;
 
 };
@@ -293,6 +298,9 @@ Albany::PhaseProblem::constructEvaluators(
     p->set<string>("Temperature Name","Temperature");
     p->set<Teuchos::ParameterList*>("Parameter List", &param_list);
 
+    if (!active_region_.is_null())
+      p->set<RCP<AMP::ActiveRegion> >("Active Region", active_region_);
+
     //Output
     p->set<string>("Phi Name","Phi");
     p->set<string>("Psi Name","Psi");
@@ -332,6 +340,9 @@ Albany::PhaseProblem::constructEvaluators(
     p->set<string>("Temperature Name","Temperature");
     p->set<Teuchos::ParameterList*>("Parameter List", &param_list); 
 
+    if (!active_region_.is_null())
+      p->set<RCP<AMP::ActiveRegion> >("Active Region", active_region_);
+
     //Output
     p->set<string>("Psi Name","Psi");
 
@@ -448,6 +459,9 @@ Albany::PhaseProblem::constructEvaluators(
     p->set<string>("Porosity Name", "Porosity");
     p->set<Teuchos::ParameterList*>("Parameter List", &param_list);
 
+    if (!active_region_.is_null())
+      p->set<RCP<AMP::ActiveRegion> >("Active Region", active_region_);
+
     //Output
     p->set<string>("Laser Source Name", "Laser Source");
     
@@ -498,6 +512,9 @@ Albany::PhaseProblem::constructEvaluators(
            material_db_->getElementBlockSublist(eb_name, "Rho Cp");
          p->set<Teuchos::ParameterList*>("Volumetric Heat Capacity Dense Parameter List", &param_list_rhocp);
 
+    if (!active_region_.is_null())
+      p->set<RCP<AMP::ActiveRegion> >("Active Region", active_region_);
+
     //Output
     p->set<string>("Energy Rate Name", "Energy Rate");
 
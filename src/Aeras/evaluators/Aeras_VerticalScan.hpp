@@ -0,0 +1,74 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_VERTICALSCAN_HPP
+#define AERAS_VERTICALSCAN_HPP
+
+#include "Kokkos_Macros.hpp"
+
+namespace Aeras {
+
+/* Running sums over the levels of one column, level 0 at the top.
+ *
+ * The hydrostatic evaluators integrate in the vertical: the geopotential
+ * sums the layers below a level, omega and etadotpi the layers above it.
+ * Summing from scratch at every level is O(numLevels^2) per node; these
+ * scans carry the sum along and are O(numLevels).
+ *
+ * The terms come from term(level), so they can combine several fields,
+ * and each result is handed to store(level, value). ScalarT is the
+ * evaluation type's scalar, so the derivatives of FAD types are carried
+ * along the sum. With weight w the value stored at a level is the sum of
+ * the levels passed before it plus w times its own term: w = 0 is an
+ * exclusive scan, w = 1 an inclusive one, and w = 0.5 sums up to the
+ * middle of the level.
+ */
+namespace VerticalScan {
+
+//! Sums from the top: store(level, sum_{j<level} term(j) + w*term(level)).
+//! Returns the sum of all levels.
+template <typename ScalarT, typename Term, typename Store>
+KOKKOS_INLINE_FUNCTION
+ScalarT down(const int numLevels, const double w, const Term& term, const Store& store)
+{
+  ScalarT sum = 0;
+  for (int level=0; level < numLevels; ++level) {
+    const ScalarT t = term(level);
+    store(level, sum + w*t);
+    sum += t;
+  }
+  return sum;
+}
+
+//! Sums from the bottom: store(level, sum_{j>level} term(j) + w*term(level)).
+//! Returns the sum of all levels.
+template <typename ScalarT, typename Term, typename Store>
+KOKKOS_INLINE_FUNCTION
+ScalarT up(const int numLevels, const double w, const Term& term, const Store& store)
+{
+  ScalarT sum = 0;
+  for (int level=numLevels-1; level >= 0; --level) {
+    const ScalarT t = term(level);
+    store(level, sum + w*t);
+    sum += t;
+  }
+  return sum;
+}
+
+//! Sum of term(level) over the column
+template <typename ScalarT, typename Term>
+KOKKOS_INLINE_FUNCTION
+ScalarT sum(const int numLevels, const Term& term)
+{
+  ScalarT s = 0;
+  for (int level=0; level < numLevels; ++level) s += term(level);
+  return s;
+}
+
+} // namespace VerticalScan
+} // namespace Aeras
+
+#endif
@@ -16,6 +16,7 @@
 #include "Aeras_Dimension.hpp"
 
 #include "Aeras_Eta.hpp"
+#include "Aeras_VerticalScan.hpp"
 #include "Kokkos_Vector.hpp"
 
 namespace Aeras {
@@ -114,17 +115,16 @@ KOKKOS_INLINE_FUNCTION
 void XZHydrostatic_EtaDotPi<EvalT, Traits>::
 operator() (const XZHydrostatic_EtaDotPi_Tag& tag, const int& cell) const{
   for (int qp=0; qp < numQPs; ++qp) {
-    ScalarT pdotp0 = 0;
-    for (int level=0; level < numLevels; ++level) pdotp0 -= divpivelx(cell,qp,level) * delta(level);
-
-    //etadotpi(level) shifted by 1/2
-    for (int level=0; level < numLevels; ++level) {
-      //define etadotpi on interfaces
-      ScalarT integral = 0;
-      for (int j=0; j<=level; ++j) integral += divpivelx(cell,qp,j) * delta(j);
-
-      etadotpi(cell,level) = -b(level+1)*pdotp0 - integral;
-    }
+    //etadotpi(level) shifted by 1/2, first holding the integral down to the interface
+    const ScalarT pdotp0 = -VerticalScan::down<ScalarT>(numLevels, 1.0,
+      [&](const int level) -> ScalarT {
+        return divpivelx(cell,qp,level) * delta(level); },
+      [&](const int level, const ScalarT& integral) {
+        etadotpi(cell,level) = integral; });
+
+    //define etadotpi on interfaces
+    for (int level=0; level < numLevels; ++level)
+      etadotpi(cell,level) = -b(level+1)*pdotp0 - etadotpi(cell,level);
     etadotpi(cell,0) = etadotpi(cell,numLevels) = 0;
 
     //Vertical Finite Differencing
@@ -239,13 +239,15 @@ evaluateFields(typename Traits::EvalData workset)
     for (int cell=0; cell < workset.numCells; ++cell) {
       for (int qp=0; qp < numQPs; ++qp) {
 
-        ScalarT pdotp0 = 0;
-	for (int level=0; level < numLevels; ++level) pdotp0 -= divpivelx(cell,qp,level) * E.delta(level);
+	//etadotpi first holds the integral of the divergence down to the interface
+	const ScalarT pdotp0 = -VerticalScan::down<ScalarT>(numLevels, 1.0,
+	  [&](const int level) -> ScalarT {
+	    return divpivelx(cell,qp,level) * E.delta(level); },
+	  [&](const int level, const ScalarT& integral) {
+	    etadotpi[level] = integral; });
 	for (int level=0; level < numLevels; ++level) {
 	  //define etadotpi on interfaces
-	  ScalarT integral = 0;
-	  for (int j=0; j<=level; ++j) integral += divpivelx(cell,qp,j) * E.delta(j);
-	  etadotpi[level] = -E.B(level+.5)*pdotp0 - integral;
+	  etadotpi[level] = -E.B(level+.5)*pdotp0 - etadotpi[level];
 	}
 	etadotpi[0] = etadotpi[numLevels] = 0;
 
@@ -15,6 +15,7 @@
 #include "Aeras_Layouts.hpp"
 
 #include "Aeras_Eta.hpp"
+#include "Aeras_VerticalScan.hpp"
 namespace Aeras {
 
 //**********************************************************************
@@ -75,14 +76,11 @@ KOKKOS_INLINE_FUNCTION
 void XZHydrostatic_GeoPotential<EvalT, Traits>::
 operator() (const XZHydrostatic_GeoPotential_Tag& tag, const int& cell) const{
   for (int node=0; node < numNodes; ++node) {
-    for (int level=0; level < numLevels; ++level) {
-      ScalarT sum =
-      PhiSurf(cell,node) +
-      0.5 * Pi(cell,node,level) * delta(level) / density(cell,node,level);
-      for (int j=level+1; j < numLevels; ++j) sum += Pi(cell,node,j)     * delta(j)     / density(cell,node,j);
-
-      Phi(cell,node,level) = sum;
-    }
+    VerticalScan::up<ScalarT>(numLevels, 0.5,
+      [&](const int level) -> ScalarT {
+        return Pi(cell,node,level) * delta(level) / density(cell,node,level); },
+      [&](const int level, const ScalarT& sum) {
+        Phi(cell,node,level) = PhiSurf(cell,node) + sum; });
   }
 }
 
@@ -96,17 +94,12 @@ evaluateFields(typename Traits::EvalData workset)
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int node=0; node < numNodes; ++node) {
-      for (int level=0; level < numLevels; ++level) {
-        ScalarT sum =
-        PhiSurf(cell,node) +
-        0.5 * Pi(cell,node,level) * E.delta(level) / density(cell,node,level);
-        for (int j=level+1; j < numLevels; ++j) sum += Pi(cell,node,j)     * E.delta(j)     / density(cell,node,j);
-
-        Phi(cell,node,level) = sum;
-        
-        //std::cout <<"Inside GeoP, cell, node, PhiSurf(cell,node)="<<cell<<
-        //", "<<node<<", "<<PhiSurf(cell,node) <<std::endl;
-      }
+      // Phi = PhiSurf + sum of the layers below the middle of the level
+      VerticalScan::up<ScalarT>(numLevels, 0.5,
+        [&](const int level) -> ScalarT {
+          return Pi(cell,node,level) * E.delta(level) / density(cell,node,level); },
+        [&](const int level, const ScalarT& sum) {
+          Phi(cell,node,level) = PhiSurf(cell,node) + sum; });
     }
   }
 
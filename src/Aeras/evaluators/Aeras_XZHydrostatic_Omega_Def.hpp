@@ -15,6 +15,7 @@
 #include "Aeras_Layouts.hpp"
 
 #include "Aeras_Eta.hpp"
+#include "Aeras_VerticalScan.hpp"
 
 namespace Aeras {
 
@@ -75,12 +76,13 @@ KOKKOS_INLINE_FUNCTION
 void XZHydrostatic_Omega<EvalT, Traits>::
 operator() (const XZHydrostatic_Omega_Tag& tag, const int& cell) const{
   for (int qp=0; qp < numQPs; ++qp) {
-    for (int level=0; level < numLevels; ++level) {
-      ScalarT                               sum  = -0.5*divpivelx(cell,qp,level) * delta(level);
-      for (int j=0; j<level; ++j)           sum -=     divpivelx(cell,qp,j)     * delta(j);
-      for (int dim=0; dim < numDims; ++dim) sum += Velocity(cell,qp,level,dim)*gradp(cell,qp,level,dim);
-      omega(cell,qp,level) = sum/(Cpstar(cell,qp,level)*density(cell,qp,level));
-    }
+    VerticalScan::down<ScalarT>(numLevels, 0.5,
+      [&](const int level) -> ScalarT {
+        return divpivelx(cell,qp,level) * delta(level); },
+      [&](const int level, const ScalarT& divsum) {
+        ScalarT                               sum  = -divsum;
+        for (int dim=0; dim < numDims; ++dim) sum += Velocity(cell,qp,level,dim)*gradp(cell,qp,level,dim);
+        omega(cell,qp,level) = sum/(Cpstar(cell,qp,level)*density(cell,qp,level)); });
   }
 }
 
@@ -94,12 +96,14 @@ evaluateFields(typename Traits::EvalData workset)
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
-      for (int level=0; level < numLevels; ++level) {
-        ScalarT                               sum  = -0.5*divpivelx(cell,qp,level) * E.delta(level);
-        for (int j=0; j<level; ++j)           sum -=     divpivelx(cell,qp,j)     * E.delta(j);
-        for (int dim=0; dim < numDims; ++dim) sum += Velocity(cell,qp,level,dim)*gradp(cell,qp,level,dim);
-        omega(cell,qp,level) = sum/(Cpstar(cell,qp,level)*density(cell,qp,level));
-      }
+      // divsum = divergence summed down to the middle of the level
+      VerticalScan::down<ScalarT>(numLevels, 0.5,
+        [&](const int level) -> ScalarT {
+          return divpivelx(cell,qp,level) * E.delta(level); },
+        [&](const int level, const ScalarT& divsum) {
+          ScalarT                               sum  = -divsum;
+          for (int dim=0; dim < numDims; ++dim) sum += Velocity(cell,qp,level,dim)*gradp(cell,qp,level,dim);
+          omega(cell,qp,level) = sum/(Cpstar(cell,qp,level)*density(cell,qp,level)); });
     }
   }
 
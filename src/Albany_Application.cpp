@@ -11,6 +11,7 @@
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
+#include "Albany_Memory.hpp"
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_OrthogPolyBasis.hpp"
 #endif
@@ -46,6 +47,8 @@
 
 #include "Albany_ScalarResponseFunction.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_GeometryCache.hpp"
+#include "utility/EvaluationProfiler.hpp"
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -367,6 +370,8 @@ void Albany::Application::initialSetUp(const RCP<Teuchos::ParameterList>& params
   writeToCoutJac = debugParams->get("Write Jacobian to Standard Output", 0);
   writeToCoutRes = debugParams->get("Write Residual to Standard Output", 0);
   derivatives_check_ = debugParams->get<int>("Derivative Check", 0);
+  util::EvaluationProfiler::instance().setup(*debugParams);
+  Albany::setMemoryPhaseTracking(debugParams->get<bool>("Analyze Memory", false));
   //the above 4 parameters cannot have values < -1
   if (writeToMatrixMarketJac < -1)  {TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
                                   std::endl << "Error in Albany::Application constructor:  " <<
@@ -641,6 +646,11 @@ void Albany::Application::finalSetUp(const Teuchos::RCP<Teuchos::ParameterList>&
 
   perturbBetaForDirichlets = problemParams->get("Perturb Dirichlet",0.0);
 
+  // Budget of this application's discretization only; the other
+  // applications of a coupled run keep theirs
+  PHAL::GeometryCache::instance().setMemoryBudget(disc.get(),
+    problemParams->get("Geometry Cache Memory Budget", 0.0));
+
   is_adjoint =
     problemParams->get("Solve Adjoint", false);
 
@@ -694,6 +704,8 @@ void Albany::Application::finalSetUp(const Teuchos::RCP<Teuchos::ParameterList>&
 Albany::Application::
 ~Application()
 {
+  // The cached geometry holds device views of this discretization
+  PHAL::GeometryCache::instance().clear(disc.get());
 #ifdef ALBANY_DEBUG
   *out << "Calling destructor for Albany_Application" << std::endl;
 #endif
@@ -1171,9 +1183,13 @@ computeGlobalResidualImplT(
 
     for (int ws=0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+      util::EvaluationProfiler::Scope profile("Residual", wsEBNames[ws], ws,
+                                              workset.numCells, 0);
+      const double wsStart = Teuchos::Time::wallTime();
 
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+      disc->addWorksetCost(ws, Teuchos::Time::wallTime() - wsStart);
       if (nfm!=Teuchos::null)
          deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
     }
@@ -1383,6 +1399,7 @@ computeGlobalJacobianImplT(const double alpha,
                            const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
 {
   TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
+  Albany::MemoryPhaseGuard memoryPhase(Albany::MEMORY_PHASE_JACOBIAN_FILL);
 
   postRegSetup("Jacobian");
 
@@ -1441,19 +1458,14 @@ computeGlobalJacobianImplT(const double alpha,
   jacT->setAllToScalar(0.0);
 
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if ( ! overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-#endif
-  overlapped_jacT->setAllToScalar(0.0);
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
+  // The scatter kernels sum into getLocalMatrix(), which is valid once the
+  // matrix has been fill completed. Each Jacobian fill ends fill complete,
+  // so only a matrix left fill active elsewhere needs it here.
+  if (overlapped_jacT->isFillActive())
     overlapped_jacT->fillComplete();
-  }
-  if ( ! overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-
+  overlapped_jacT->resumeFill();
 #endif
+  overlapped_jacT->setAllToScalar(0.0);
 
   // Set data in Workset struct, and perform fill via field manager
   {
@@ -1479,8 +1491,13 @@ computeGlobalJacobianImplT(const double alpha,
 
     for (int ws=0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
+      util::EvaluationProfiler::Scope profile("Jacobian", wsEBNames[ws], ws,
+                                              workset.numCells,
+                                              workset.Jacobian_deriv_dims[wsPhysIndex[ws]]);
+      const double wsStart = Teuchos::Time::wallTime();
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+      disc->addWorksetCost(ws, Teuchos::Time::wallTime() - wsStart);
       if (Teuchos::nonnull(nfm))
         deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
     }
@@ -2050,6 +2067,9 @@ for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  "
     for (int ws=0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Tangent>(workset, ws);
       workset.ws_coord_derivs = ws_coord_derivs[ws];
+      util::EvaluationProfiler::Scope profile("Tangent", wsEBNames[ws], ws,
+                                              workset.numCells,
+                                              workset.num_cols_x + workset.num_cols_p);
 
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
@@ -2358,6 +2378,8 @@ applyGlobalDistParamDerivImplT(const double current_time,
 
     for (int ws=0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::DistParamDeriv>(workset, ws);
+      util::EvaluationProfiler::Scope profile("DistParamDeriv", wsEBNames[ws], ws,
+                                              workset.numCells, 0);
 
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::DistParamDeriv>(workset);
@@ -2586,12 +2608,14 @@ computeGlobalSGResidual(
             sg_basis, sg_overlap_map, disc->getOverlapMap(), product_comm));
   }
 
-  for (int i=0; i<sg_x.size(); i++) {
+  // Scatter x and xdot to the overlapped distrbution, all blocks at once
+  SGBlockExporter::importBlocks(*sg_overlapped_x, sg_x, sg_x.size(), *importer, Insert);
+  if (sg_xdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdot, *sg_xdot, sg_x.size(), *importer, Insert);
+  if (sg_xdotdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdotdot, *sg_xdotdot, sg_x.size(), *importer, Insert);
 
-    // Scatter x and xdot to the overlapped distrbution
-    (*sg_overlapped_x)[i].Import(sg_x[i], *importer, Insert);
-    if (sg_xdot != NULL) (*sg_overlapped_xdot)[i].Import((*sg_xdot)[i], *importer, Insert);
-    if (sg_xdotdot != NULL) (*sg_overlapped_xdotdot)[i].Import((*sg_xdotdot)[i], *importer, Insert);
+  for (int i=0; i<sg_x.size(); i++) {
 
     // Zero out overlapped residual
     (*sg_overlapped_f)[i].PutScalar(0.0);
@@ -2652,9 +2676,7 @@ for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  "
   }
 
   // Assemble global residual
-  for (int i=0; i<sg_f.size(); i++) {
-    sg_f[i].Export((*sg_overlapped_f)[i], *exporter, Add);
-  }
+  SGBlockExporter::exportBlocks(sg_f, *sg_overlapped_f, sg_f.size(), *exporter, Add);
 
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
   if (dfm!=Teuchos::null) {
@@ -2740,12 +2762,14 @@ computeGlobalSGJacobian(
             sg_basis, sg_overlap_map, disc->getOverlapMap(), product_comm));
   }
 
-  for (int i=0; i<sg_x.size(); i++) {
+  // Scatter x and xdot to the overlapped distrbution, all blocks at once
+  SGBlockExporter::importBlocks(*sg_overlapped_x, sg_x, sg_x.size(), *importer, Insert);
+  if (sg_xdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdot, *sg_xdot, sg_x.size(), *importer, Insert);
+  if (sg_xdotdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdotdot, *sg_xdotdot, sg_x.size(), *importer, Insert);
 
-    // Scatter x and xdot to the overlapped distrbution
-    (*sg_overlapped_x)[i].Import(sg_x[i], *importer, Insert);
-    if (sg_xdot != NULL) (*sg_overlapped_xdot)[i].Import((*sg_xdot)[i], *importer, Insert);
-    if (sg_xdotdot != NULL) (*sg_overlapped_xdotdot)[i].Import((*sg_xdotdot)[i], *importer, Insert);
+  for (int i=0; i<sg_x.size(); i++) {
 
     // Zero out overlapped residual
     if (sg_f != NULL) {
@@ -2834,17 +2858,15 @@ for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  "
 
   // Assemble global residual
   if (sg_f != NULL)
-    for (int i=0; i<sg_f->size(); i++)
-      (*sg_f)[i].Export((*sg_overlapped_f)[i], *exporter, Add);
+    SGBlockExporter::exportBlocks(*sg_f, *sg_overlapped_f, sg_f->size(), *exporter, Add);
 
-  // Assemble block Jacobians
-  RCP<Epetra_CrsMatrix> jac;
-  for (int i=0; i<sg_jac.size(); i++) {
-    jac = sg_jac.getCoeffPtr(i);
-    jac->PutScalar(0.0);
-    jac->Export((*sg_overlapped_jac)[i], *exporter, Add);
-    jac->FillComplete(true);
-  }
+  // Assemble block Jacobians, all blocks at once
+  if (sg_block_exporter == Teuchos::null)
+    sg_block_exporter = rcp(new SGBlockExporter(
+        problemParams->get("Stacked SG Jacobian Export", true)));
+  sg_block_exporter->exportMatrices(sg_jac, *sg_overlapped_jac, *exporter);
+  for (int i=0; i<sg_jac.size(); i++)
+    sg_jac[i].FillComplete(true);
 
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
   if (dfm!=Teuchos::null) {
@@ -2934,12 +2956,14 @@ computeGlobalSGTangent(
             sg_basis, sg_overlap_map, disc->getOverlapMap(), product_comm));
   }
 
-  for (int i=0; i<sg_x.size(); i++) {
+  // Scatter x and xdot to the overlapped distrbution, all blocks at once
+  SGBlockExporter::importBlocks(*sg_overlapped_x, sg_x, sg_x.size(), *importer, Insert);
+  if (sg_xdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdot, *sg_xdot, sg_x.size(), *importer, Insert);
+  if (sg_xdotdot != NULL)
+    SGBlockExporter::importBlocks(*sg_overlapped_xdotdot, *sg_xdotdot, sg_x.size(), *importer, Insert);
 
-    // Scatter x and xdot to the overlapped distrbution
-    (*sg_overlapped_x)[i].Import(sg_x[i], *importer, Insert);
-    if (sg_xdot != NULL) (*sg_overlapped_xdot)[i].Import((*sg_xdot)[i], *importer, Insert);
-    if (sg_xdotdot != NULL) (*sg_overlapped_xdotdot)[i].Import((*sg_xdotdot)[i], *importer, Insert);
+  for (int i=0; i<sg_x.size(); i++) {
 
     // Zero out overlapped residual
     if (sg_f != NULL) {
@@ -3107,17 +3131,13 @@ computeGlobalSGTangent(
 
   // Assemble global residual
   if (sg_f != NULL)
-    for (int i=0; i<sg_f->size(); i++)
-      (*sg_f)[i].Export((*sg_overlapped_f)[i], *exporter, Add);
+    SGBlockExporter::exportBlocks(*sg_f, *sg_overlapped_f, sg_f->size(), *exporter, Add);
 
   // Assemble derivatives
   if (sg_JVx != NULL)
-    for (int i=0; i<sg_JVx->size(); i++)
-      (*sg_JVx)[i].Export((*sg_overlapped_JVx)[i], *exporter, Add);
-  if (sg_fVp != NULL) {
-    for (int i=0; i<sg_fVp->size(); i++)
-      (*sg_fVp)[i].Export((*sg_overlapped_fVp)[i], *exporter, Add);
-  }
+    SGBlockExporter::exportBlocks(*sg_JVx, *sg_overlapped_JVx, sg_JVx->size(), *exporter, Add);
+  if (sg_fVp != NULL)
+    SGBlockExporter::exportBlocks(*sg_fVp, *sg_overlapped_fVp, sg_fVp->size(), *exporter, Add);
 
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
   if (dfm!=Teuchos::null) {
@@ -3840,6 +3860,253 @@ computeGlobalMPTangent(
 
 }
 
+void
+Albany::Application::
+computeGlobalMPResidualT(
+  const double current_time,
+  const Tpetra_MultiVector* mp_xdotT,
+  const Tpetra_MultiVector* mp_xdotdotT,
+  const Tpetra_MultiVector& mp_xT,
+  const Teuchos::Array<ParamVec>& p,
+  const Teuchos::Array<int>& mp_p_index,
+  const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+  Tpetra_MultiVector& mp_fT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: MPResidual");
+
+  postRegSetup("MPResidual");
+
+  // Load connectivity map and coordinates
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type&
+        wsElNodeEqID = disc->getWsElNodeEqID();
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+
+  int numWorksets = wsElNodeEqID.size();
+
+  Teuchos::RCP<Tpetra_Import> importerT = solMgrT->get_importerT();
+  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
+  // Create overlapped multi-point Tpetra objects, one column per member
+  const std::size_t nblock = mp_xT.getNumVectors();
+  Teuchos::RCP<const Tpetra_Map> overlapMapT = disc->getOverlapMapT();
+  if (mp_overlapped_xT == Teuchos::null ||
+      mp_overlapped_xT->getNumVectors() != nblock ||
+      !mp_overlapped_xT->getMap()->isSameAs(*overlapMapT)) {
+    mp_overlapped_xT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_xdotT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_xdotdotT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_fT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+  }
+
+  // Scatter x and xdot to the overlapped distribution, all members at once
+  mp_overlapped_xT->doImport(mp_xT, *importerT, Tpetra::INSERT);
+  if (mp_xdotT != NULL) mp_overlapped_xdotT->doImport(*mp_xdotT, *importerT, Tpetra::INSERT);
+  if (mp_xdotdotT != NULL) mp_overlapped_xdotdotT->doImport(*mp_xdotdotT, *importerT, Tpetra::INSERT);
+
+  // Zero out overlapped residual
+  mp_overlapped_fT->putScalar(0.0);
+  mp_fT.putScalar(0.0);
+
+  // Set parameters
+  for (int i=0; i<p.size(); i++)
+    for (unsigned int j=0; j<p[i].size(); j++)
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+
+  // Set MP parameters
+  for (int i=0; i<mp_p_index.size(); i++) {
+    int ii = mp_p_index[i];
+    for (unsigned int j=0; j<p[ii].size(); j++)
+      p[ii][j].family->setValue<PHAL::AlbanyTraits::MPResidual>(mp_p_vals[ii][j]);
+  }
+
+  // Set data in Workset struct, and perform fill via field manager
+  {
+    PHAL::Workset workset;
+
+    workset.mp_xT        = mp_overlapped_xT;
+    if (mp_xdotT != NULL) workset.mp_xdotT = mp_overlapped_xdotT;
+    if (mp_xdotdotT != NULL) workset.mp_xdotdotT = mp_overlapped_xdotdotT;
+    workset.mp_fT        = mp_overlapped_fT;
+
+    workset.current_time = current_time;
+    if (mp_xdotT != NULL) workset.transientTerms = true;
+    if (mp_xdotdotT != NULL) workset.accelerationTerms = true;
+
+    for (int ws=0; ws < numWorksets; ws++) {
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::MPResidual>(workset, ws);
+
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+      if (nfm!=Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+    }
+  }
+
+  // Assemble global residual: one export for all members
+  mp_fT.doExport(*mp_overlapped_fT, *exporterT, Tpetra::ADD);
+
+  // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  if (dfm!=Teuchos::null) {
+    PHAL::Workset workset;
+
+    workset.mp_fT = Teuchos::rcpFromRef(mp_fT);
+    loadWorksetNodesetInfo(workset);
+    workset.distParamLib = distParamLib;
+    workset.mp_xT = Teuchos::rcpFromRef(mp_xT);
+    if (mp_xdotT != NULL) workset.transientTerms = true;
+    if (mp_xdotdotT != NULL) workset.accelerationTerms = true;
+
+    workset.disc = disc;
+
+    // FillType template argument used to specialize Sacado
+    dfm->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+  }
+}
+
+void
+Albany::Application::
+computeGlobalMPJacobianT(
+  const double alpha,
+  const double beta,
+  const double omega,
+  const double current_time,
+  const Tpetra_MultiVector* mp_xdotT,
+  const Tpetra_MultiVector* mp_xdotdotT,
+  const Tpetra_MultiVector& mp_xT,
+  const Teuchos::Array<ParamVec>& p,
+  const Teuchos::Array<int>& mp_p_index,
+  const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+  Tpetra_MultiVector* mp_fT,
+  const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& mp_jacT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: MPJacobian");
+
+  postRegSetup("MPJacobian");
+
+  // Load connectivity map and coordinates
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type&
+        wsElNodeEqID = disc->getWsElNodeEqID();
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+
+  int numWorksets = wsElNodeEqID.size();
+
+  Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT = solMgrT->get_overlapped_jacT();
+  Teuchos::RCP<Tpetra_Import> importerT = solMgrT->get_importerT();
+  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
+  // Create overlapped multi-point Tpetra objects, one column per member
+  const std::size_t nblock = mp_xT.getNumVectors();
+  Teuchos::RCP<const Tpetra_Map> overlapMapT = disc->getOverlapMapT();
+  if (mp_overlapped_xT == Teuchos::null ||
+      mp_overlapped_xT->getNumVectors() != nblock ||
+      !mp_overlapped_xT->getMap()->isSameAs(*overlapMapT)) {
+    mp_overlapped_xT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_xdotT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_xdotdotT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+    mp_overlapped_fT = rcp(new Tpetra_MultiVector(overlapMapT, nblock));
+  }
+
+  // The members' overlapped Jacobians share the overlapped graph
+  if (mp_overlapped_jacT == Teuchos::null ||
+      mp_overlapped_jacT->size() != mp_jacT.size() ||
+      (mp_overlapped_jacT->size() > 0 &&
+       (*mp_overlapped_jacT)[0]->getCrsGraph() != overlapped_jacT->getCrsGraph())) {
+    mp_overlapped_jacT = Teuchos::rcp(
+      new Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >(mp_jacT.size()));
+    for (int i=0; i<mp_jacT.size(); i++)
+      (*mp_overlapped_jacT)[i] =
+        Teuchos::rcp(new Tpetra_CrsMatrix(overlapped_jacT->getCrsGraph()));
+  }
+
+  // Scatter x and xdot to the overlapped distribution, all members at once
+  mp_overlapped_xT->doImport(mp_xT, *importerT, Tpetra::INSERT);
+  if (mp_xdotT != NULL) mp_overlapped_xdotT->doImport(*mp_xdotT, *importerT, Tpetra::INSERT);
+  if (mp_xdotdotT != NULL) mp_overlapped_xdotdotT->doImport(*mp_xdotdotT, *importerT, Tpetra::INSERT);
+
+  // Zero out overlapped residual and Jacobians
+  if (mp_fT != NULL) {
+    mp_overlapped_fT->putScalar(0.0);
+    mp_fT->putScalar(0.0);
+  }
+
+  for (int i=0; i<mp_jacT.size(); i++) {
+    mp_jacT[i]->resumeFill();
+    mp_jacT[i]->setAllToScalar(0.0);
+    (*mp_overlapped_jacT)[i]->resumeFill();
+    (*mp_overlapped_jacT)[i]->setAllToScalar(0.0);
+  }
+
+  // Set parameters
+  for (int i=0; i<p.size(); i++)
+    for (unsigned int j=0; j<p[i].size(); j++)
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+
+  // Set MP parameters
+  for (int i=0; i<mp_p_index.size(); i++) {
+    int ii = mp_p_index[i];
+    for (unsigned int j=0; j<p[ii].size(); j++)
+      p[ii][j].family->setValue<PHAL::AlbanyTraits::MPJacobian>(mp_p_vals[ii][j]);
+  }
+
+  // Set data in Workset struct, and perform fill via field manager
+  {
+    PHAL::Workset workset;
+
+    workset.mp_xT        = mp_overlapped_xT;
+    if (mp_xdotT != NULL) workset.mp_xdotT = mp_overlapped_xdotT;
+    if (mp_xdotdotT != NULL) workset.mp_xdotdotT = mp_overlapped_xdotdotT;
+    if (mp_fT != NULL) workset.mp_fT = mp_overlapped_fT;
+
+    workset.mp_JacT      = mp_overlapped_jacT;
+    loadWorksetJacobianInfo(workset, alpha, beta, omega);
+    workset.current_time = current_time;
+    if (mp_xdotT != NULL) workset.transientTerms = true;
+    if (mp_xdotdotT != NULL) workset.accelerationTerms = true;
+
+    for (int ws=0; ws < numWorksets; ws++) {
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::MPJacobian>(workset, ws);
+
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+      if (nfm!=Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+    }
+  }
+
+  // Assemble global residual: one export for all members
+  if (mp_fT != NULL)
+    mp_fT->doExport(*mp_overlapped_fT, *exporterT, Tpetra::ADD);
+
+  // Assemble block Jacobians, all members at once
+  if (mp_block_exporterT == Teuchos::null)
+    mp_block_exporterT = rcp(new MPBlockExporterT);
+  mp_block_exporterT->exportMatrices(mp_jacT, *mp_overlapped_jacT, *exporterT);
+
+  // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  if (dfm!=Teuchos::null) {
+    PHAL::Workset workset;
+
+    if (mp_fT != NULL) workset.mp_fT = Teuchos::rcp(mp_fT, false);
+    workset.mp_JacT = Teuchos::rcpFromRef(mp_jacT);
+    workset.j_coeff = beta;
+    workset.n_coeff = omega;
+    workset.mp_xT = Teuchos::rcpFromRef(mp_xT);
+    if (mp_xdotT != NULL) workset.transientTerms = true;
+    if (mp_xdotdotT != NULL) workset.accelerationTerms = true;
+
+    loadWorksetNodesetInfo(workset);
+    workset.distParamLib = distParamLib;
+
+    workset.disc = disc;
+
+    // FillType template argument used to specialize Sacado
+    dfm->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+  }
+
+  for (int i=0; i<mp_jacT.size(); i++)
+    mp_jacT[i]->fillComplete();
+}
+
 void
 Albany::Application::
 evaluateMPResponse(
@@ -56,8 +56,12 @@
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_EpetraVectorOrthogPoly.hpp"
 #include "Stokhos_EpetraMultiVectorOrthogPoly.hpp"
+#include "Albany_SGBlockExporter.hpp"
 #endif
 #include "EpetraExt_MultiComm.h"
+#ifdef ALBANY_ENSEMBLE
+#include "Albany_MPBlockExporterT.hpp"
+#endif
 
 #include "LOCA_Epetra_Group.H"
 #ifdef ALBANY_TEKO
@@ -153,6 +157,11 @@ namespace Albany {
 #endif
     Teuchos::RCP<AAdapt::AdaptiveSolutionManagerT> getAdaptSolMgrT(){ return solMgrT;}
 
+    //! Set the initial guess of the next solve, replacing the nominal
+    //! solution (null restores it); used to warm start repeated solves
+    void setInitialGuessT(const Teuchos::RCP<const Tpetra_Vector>& xT) { initialGuessT = xT; }
+    Teuchos::RCP<const Tpetra_Vector> getInitialGuessT() const { return initialGuessT; }
+
     //! Get parameter library
     Teuchos::RCP<ParamLib> getParamLib() const;
 
@@ -614,6 +623,43 @@ namespace Albany {
       Stokhos::ProductEpetraMultiVector* mp_JVx,
       Stokhos::ProductEpetraMultiVector* mp_fVp);
 
+    //! Compute global residual for multi-point problem with Tpetra
+    /*!
+     * Column i of mp_xT, mp_xdotT, mp_xdotdotT and mp_fT is ensemble member
+     * i. All members are evaluated in one sweep over the worksets and are
+     * imported and exported together, as one multivector.
+     * Set xdot to NULL for steady-state problems
+     */
+    void computeGlobalMPResidualT(
+      const double current_time,
+      const Tpetra_MultiVector* mp_xdotT,
+      const Tpetra_MultiVector* mp_xdotdotT,
+      const Tpetra_MultiVector& mp_xT,
+      const Teuchos::Array<ParamVec>& p,
+      const Teuchos::Array<int>& mp_p_index,
+      const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+      Tpetra_MultiVector& mp_fT);
+
+    //! Compute global Jacobian for multi-point problem with Tpetra
+    /*!
+     * As computeGlobalMPResidualT; entry i of mp_jacT is the Jacobian of
+     * member i. The matrices must have the graph of the problem's Jacobian.
+     * Set xdot to NULL for steady-state problems
+     */
+    void computeGlobalMPJacobianT(
+      const double alpha,
+      const double beta,
+      const double omega,
+      const double current_time,
+      const Tpetra_MultiVector* mp_xdotT,
+      const Tpetra_MultiVector* mp_xdotdotT,
+      const Tpetra_MultiVector& mp_xT,
+      const Teuchos::Array<ParamVec>& p,
+      const Teuchos::Array<int>& mp_p_index,
+      const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+      Tpetra_MultiVector* mp_fT,
+      const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& mp_jacT);
+
     //! Evaluate stochastic Galerkin response functions
     /*!
      * Set xdot to NULL for steady-state problems
@@ -1063,6 +1109,9 @@ namespace Albany {
     //! Solution memory manager
     Teuchos::RCP<AAdapt::AdaptiveSolutionManagerT> solMgrT;
 
+    //! Initial guess replacing the nominal solution, if not null
+    Teuchos::RCP<const Tpetra_Vector> initialGuessT;
+
     //! Reference configuration (update) manager
     Teuchos::RCP<AAdapt::rc::Manager> rc_mgr;
 
@@ -1113,6 +1162,9 @@ namespace Albany {
     //! Overlapped Jacobian matrixs
     Teuchos::RCP< Stokhos::VectorOrthogPoly<Epetra_CrsMatrix> > sg_overlapped_jac;
 
+    //! Exports all SG Jacobian blocks in one communication round
+    Teuchos::RCP<SGBlockExporter> sg_block_exporter;
+
     //! MP overlapped solution vectors
     Teuchos::RCP< Stokhos::ProductEpetraVector >  mp_overlapped_x;
 
@@ -1128,6 +1180,21 @@ namespace Albany {
 #endif
 #endif
 
+#ifdef ALBANY_ENSEMBLE
+    //! MP overlapped Tpetra solution, time derivative and residual
+    //! multivectors, one column per ensemble member
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xdotT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xdotdotT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_fT;
+
+    //! MP overlapped Tpetra Jacobians, sharing the overlapped graph
+    Teuchos::RCP<Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> > > mp_overlapped_jacT;
+
+    //! Exports all MP Tpetra Jacobians in one communication round
+    Teuchos::RCP<MPBlockExporterT> mp_block_exporterT;
+#endif
+
     bool explicit_scheme; 
 
     //! Data for Physics-Based Preconditioners
@@ -1266,6 +1333,19 @@ void Albany::Application::loadWorksetBucketInfo(PHAL::Workset& workset,
       for (int j=0; j< wsElNodeEqID[ws][0].size(); j++)
           for (int k=0; k<wsElNodeEqID[ws][0][0].size();k++)
               workset.wsElNodeEqID_kokkos(i,j,k)=workset.wsElNodeEqID[i][j][k]; 
+
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  // Only the Kokkos scatter uses the coloring, built with the worksets
+  const WorksetArray<Albany::WorksetColoring>::type& wsColoring = disc->getWsColoring();
+  if (ws < wsColoring.size() && wsColoring[ws].numColors() > 0) {
+    workset.wsColorCells_kokkos = wsColoring[ws].cells_kokkos;
+    workset.wsColorOffsets = wsColoring[ws].offsets;
+  }
+  else {
+    workset.wsColorCells_kokkos = Kokkos::View<int*, PHX::Device>();
+    workset.wsColorOffsets = Teuchos::null;
+  }
+#endif
 }
 
 #endif // ALBANY_APPLICATION_HPP
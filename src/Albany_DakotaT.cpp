@@ -17,6 +17,7 @@
 // JF #include "TriKota_DirectApplicInterface.hpp"
 #include "TriKota_ThyraDirectApplicInterface.hpp"
 #include "Albany_SolverFactory.hpp"
+#include "Albany_WarmStartSolverT.hpp"
 #include "Teuchos_TestForException.hpp"
 
 // Standard use case for TriKota
@@ -137,7 +138,18 @@ int Albany_DakotaT(int argc, char *argv[])
     //trikota_interface = rcp(new TriKota::DirectApplicInterface(dakota.getProblemDescDB(), App, p_index, g_index), false);
 
     // JF modifications for Albany_DakotaT
-    RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > appT = slvrfctry->createT(appCommT, appCommT);
+    RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > appT;
+    if (dakotaParams.get("Warm Start", false)) {
+      // Start each sample's solve from the nearest converged sample
+      RCP<Albany::Application> app;
+      RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > solverT =
+        slvrfctry->createAndGetAlbanyAppT(app, appCommT, appCommT);
+      TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(app), std::logic_error,
+        "Albany_DakotaT: Warm Start requires a solution method with a single Albany::Application" << std::endl);
+      appT = rcp(new Albany::WarmStartSolverT(solverT, app, dakotaParams));
+    }
+    else
+      appT = slvrfctry->createT(appCommT, appCommT);
     trikota_interface = rcp(new TriKota::ThyraDirectApplicInterface(dakota.getProblemDescDB(), appT, p_index, g_index), false);
 
   }
@@ -0,0 +1,176 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_MPBlockExporterT.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "Teuchos_CommHelpers.hpp"
+
+namespace {
+
+// m repeated n times, with the GIDs of copy i shifted by i*stride
+Teuchos::RCP<const Tpetra_Map>
+stack(const Tpetra_Map& m, const int n, const GO stride)
+{
+  const Teuchos::ArrayView<const GO> mine = m.getNodeElementList();
+  const std::size_t num = mine.size();
+  Teuchos::Array<GO> gids(n*num);
+  for (int i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < num; ++k)
+      gids[i*num + k] = mine[k] + i*stride;
+  return Teuchos::rcp(new Tpetra_Map(
+      Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid(), gids(),
+      m.getIndexBase(), m.getComm()));
+}
+
+// Block diagonal graph with n copies of g. The column indices of each row
+// keep their order, so the values of a row can be copied between a member
+// and its copy as they are.
+Teuchos::RCP<const Tpetra_CrsGraph>
+stack(const Tpetra_CrsGraph& g, const int n,
+      const Teuchos::RCP<const Tpetra_Map>& rowMap,
+      const Teuchos::RCP<const Tpetra_Map>& colMap,
+      const Teuchos::RCP<const Tpetra_Map>& domainMap,
+      const Teuchos::RCP<const Tpetra_Map>& rangeMap)
+{
+  const std::size_t rows = g.getNodeNumRows();
+  const LO cols = g.getColMap()->getNodeNumElements();
+
+  Teuchos::ArrayRCP<std::size_t> row_ptrs = Teuchos::arcp<std::size_t>(n*rows + 1);
+  Teuchos::ArrayRCP<LO> col_indices = Teuchos::arcp<LO>(n*g.getNodeNumEntries());
+  Teuchos::ArrayView<const LO> indices;
+  std::size_t k = 0;
+  row_ptrs[0] = 0;
+  for (int i = 0; i < n; ++i)
+    for (std::size_t r = 0; r < rows; ++r) {
+      g.getLocalRowView(r, indices);
+      for (int j = 0; j < indices.size(); ++j)
+        col_indices[k++] = indices[j] + i*cols;
+      row_ptrs[i*rows + r + 1] = k;
+    }
+
+  const Teuchos::RCP<Tpetra_CrsGraph> s =
+    Teuchos::rcp(new Tpetra_CrsGraph(rowMap, colMap, row_ptrs, col_indices));
+  s->expertStaticFillComplete(domainMap, rangeMap);
+  return s;
+}
+
+// Copies the values of rows from_row.. of a into rows to_row.. of b, which
+// have the same column indices in the same order up to a shift
+void copyRows(const Tpetra_CrsMatrix& a, const LO from_row,
+              Tpetra_CrsMatrix& b, const LO to_row, const LO rows)
+{
+  Teuchos::ArrayView<const LO> indices_a, indices_b;
+  Teuchos::ArrayView<const ST> values_a, values_b;
+  for (LO r = 0; r < rows; ++r) {
+    a.getLocalRowView(from_row + r, indices_a, values_a);
+    b.getLocalRowView(to_row + r, indices_b, values_b);
+    b.replaceLocalValues(to_row + r, indices_b, values_a);
+  }
+}
+
+}
+
+Albany::MPBlockExporterT::MPBlockExporterT() :
+  num_blocks(0),
+  stackable(false)
+{
+}
+
+bool
+Albany::MPBlockExporterT::setup(
+    const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& dst,
+    const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& src)
+{
+  const int n = dst.size();
+  if (n == 0 || src.size() != n) return false;
+
+  const Teuchos::RCP<const Tpetra_CrsGraph> og = src[0]->getCrsGraph();
+  const Teuchos::RCP<const Tpetra_CrsGraph> g = dst[0]->getCrsGraph();
+  const Teuchos::RCP<const Teuchos_Comm> commT = g->getComm();
+
+  // The decision to rebuild must be the same on every process. A member
+  // that no longer shares the first one's graph also counts as a change.
+  int changed = og != src_graph || g != dst_graph || n != num_blocks;
+  for (int i = 1; !changed && i < n; ++i)
+    changed = src[i]->getCrsGraph() != og || dst[i]->getCrsGraph() != g;
+  int any_changed;
+  Teuchos::reduceAll<int, int>(*commT, Teuchos::REDUCE_MAX, changed,
+                               Teuchos::outArg(any_changed));
+  if (!any_changed) return stackable;
+
+  src_graph = og;
+  dst_graph = g;
+  num_blocks = n;
+  overlapped = Teuchos::null;
+  owned = Teuchos::null;
+  exporter = Teuchos::null;
+
+  // All members must share the graph of the first one, on every process;
+  // the values are copied between the members and the stacked matrices by
+  // position
+  int ok = og->isFillComplete() && g->isFillComplete();
+  for (int i = 1; ok && i < n; ++i)
+    ok = src[i]->getCrsGraph() == og && dst[i]->getCrsGraph() == g;
+  int all_ok;
+  Teuchos::reduceAll<int, int>(*commT, Teuchos::REDUCE_MIN, ok,
+                               Teuchos::outArg(all_ok));
+  stackable = all_ok;
+  if (!stackable) return false;
+
+  const Teuchos::RCP<const Tpetra_Map> maps[] = {
+    og->getRowMap(), og->getColMap(), g->getRowMap(),
+    g->getColMap(), g->getDomainMap(), g->getRangeMap() };
+  GO min_gid = std::numeric_limits<GO>::max(), max_gid = 0;
+  for (int k = 0; k < 6; ++k) {
+    min_gid = std::min(min_gid, maps[k]->getMinAllGlobalIndex());
+    max_gid = std::max(max_gid, maps[k]->getMaxAllGlobalIndex());
+  }
+  stackable = min_gid >= 0 && max_gid < std::numeric_limits<GO>::max() / n;
+  if (!stackable) return false;
+  const GO stride = max_gid + 1;
+
+  const Teuchos::RCP<const Tpetra_Map> domainMap = stack(*g->getDomainMap(), n, stride);
+  const Teuchos::RCP<const Tpetra_Map> rangeMap = stack(*g->getRangeMap(), n, stride);
+  const Teuchos::RCP<const Tpetra_Map> ownedRowMap = stack(*g->getRowMap(), n, stride);
+  const Teuchos::RCP<const Tpetra_Map> overlapRowMap = stack(*og->getRowMap(), n, stride);
+
+  overlapped = Teuchos::rcp(new Tpetra_CrsMatrix(
+      stack(*og, n, overlapRowMap, stack(*og->getColMap(), n, stride), domainMap, rangeMap)));
+  owned = Teuchos::rcp(new Tpetra_CrsMatrix(
+      stack(*g, n, ownedRowMap, stack(*g->getColMap(), n, stride), domainMap, rangeMap)));
+  exporter = Teuchos::rcp(new Tpetra_Export(overlapRowMap, ownedRowMap));
+
+  return true;
+}
+
+void
+Albany::MPBlockExporterT::exportMatrices(
+    const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& dst,
+    const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& src,
+    const Tpetra_Export& blockExporter)
+{
+  if (!setup(dst, src)) {
+    for (int i = 0; i < dst.size(); ++i) {
+      dst[i]->setAllToScalar(0.0);
+      dst[i]->doExport(*src[i], blockExporter, Tpetra::ADD);
+    }
+    return;
+  }
+
+  const LO src_rows = src[0]->getNodeNumRows();
+  const LO dst_rows = dst[0]->getNodeNumRows();
+  for (int i = 0; i < num_blocks; ++i)
+    copyRows(*src[i], 0, *overlapped, i*src_rows, src_rows);
+
+  owned->setAllToScalar(0.0);
+  owned->doExport(*overlapped, *exporter, Tpetra::ADD);
+
+  for (int i = 0; i < num_blocks; ++i)
+    copyRows(*owned, i*dst_rows, *dst[i], 0, dst_rows);
+}
@@ -0,0 +1,64 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MPBLOCKEXPORTERT_HPP
+#define ALBANY_MPBLOCKEXPORTERT_HPP
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "Albany_DataTypes.hpp"
+
+namespace Albany {
+
+/** \brief Exports the Jacobians of all ensemble members in one communication round
+ *
+ * The Tpetra multi-point Jacobian fill gives each ensemble member its own
+ * overlapped Tpetra_CrsMatrix. Exporting them one by one costs one round of
+ * messages per member, since Tpetra has no export of several matrices at
+ * once. Here the members are copied into one block diagonal matrix whose
+ * row map is the Jacobian row map repeated once per member (with the GIDs
+ * of member i shifted by i times the GID range). That matrix is exported
+ * once, so each neighbor gets one message holding all members.
+ *
+ * The stacked overlapped and owned matrices hold a second copy of the
+ * values of every member, which doubles the memory of the ensemble
+ * Jacobians. They are built on the first export and rebuilt when the
+ * members' graphs change. If the members do not all share one fill
+ * complete graph, they are exported one by one.
+ */
+class MPBlockExporterT {
+public:
+  MPBlockExporterT();
+
+  //! Overwrites each dst[i] with the sum of the overlapped src[i]
+  /*!
+   * The matrices of dst must be fill active.
+   */
+  void exportMatrices(const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& dst,
+                      const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& src,
+                      const Tpetra_Export& exporter);
+
+private:
+  //! Builds the stacked matrices if needed; false if the members can't be stacked
+  bool setup(const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& dst,
+             const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& src);
+
+  //! Graphs the stacked matrices were built for. Held, so that a new graph
+  //! can't be taken for a freed one at the same address.
+  Teuchos::RCP<const Tpetra_CrsGraph> src_graph;
+  Teuchos::RCP<const Tpetra_CrsGraph> dst_graph;
+  int num_blocks;
+  bool stackable;
+
+  Teuchos::RCP<Tpetra_CrsMatrix> overlapped;
+  Teuchos::RCP<Tpetra_CrsMatrix> owned;
+  Teuchos::RCP<Tpetra_Export> exporter;
+};
+
+}
+
+#endif // ALBANY_MPBLOCKEXPORTERT_HPP
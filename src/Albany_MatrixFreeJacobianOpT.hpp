@@ -0,0 +1,164 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+#define ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+
+#include "Albany_DataTypes.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Albany_Application.hpp"
+
+namespace Albany {
+
+  //! Tpetra_Operator implementing the action of the Jacobian without assembling it
+  /*!
+   * This class implements the Tpetra_Operator interface for
+   * W*v = (alpha*df/dxdot + beta*df/dx + omega*df/dxdotdot)*v, where f is the
+   * Albany residual vector. Each apply() is one sweep of the Tangent
+   * evaluation type, with the solution seeded by the columns of v, so the
+   * product is exact and no matrix is stored.
+   */
+  class MatrixFreeJacobianOpT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    MatrixFreeJacobianOpT(const Teuchos::RCP<Application>& app_) :
+      app(app_),
+      alpha(0.0), beta(1.0), omega(0.0), time(0.0) {}
+
+    //! Destructor
+    virtual ~MatrixFreeJacobianOpT() {}
+
+    //! Set the point the Jacobian is evaluated at; the vectors are copied
+    void set(const double alpha_,
+             const double beta_,
+             const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdotdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& x_,
+             const Teuchos::RCP<Teuchos::Array<ParamVec> >& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      copy(xdot_, xdot);
+      copy(xdotdot_, xdotdot);
+      copy(x_, x);
+      scalar_params = scalar_params_;
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    /*!
+     * \brief Returns the result of a Tpetra_Operator applied to a
+     * Tpetra_MultiVector X in Y.
+     */
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const {
+      TEUCHOS_TEST_FOR_EXCEPTION(mode != Teuchos::NO_TRANS, std::logic_error,
+        "MatrixFreeJacobianOpT::apply:  only the non-transposed Jacobian is available" << std::endl);
+      TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(x), std::logic_error,
+        "MatrixFreeJacobianOpT::apply:  set() must be called before apply()" << std::endl);
+
+      if (Teuchos::is_null(JV) || JV->getNumVectors() != X.getNumVectors())
+        JV = Teuchos::rcp(new Tpetra_MultiVector(app->getMapT(), X.getNumVectors(), false));
+
+      app->computeGlobalTangentT(alpha, beta, omega, time, false,
+                                 xdot.get(), xdotdot.get(), *x,
+                                 *scalar_params, NULL,
+                                 &X,
+                                 Teuchos::nonnull(xdot) ? &X : NULL,
+                                 Teuchos::nonnull(xdotdot) ? &X : NULL,
+                                 NULL, NULL, JV.get(), NULL);
+
+      if (b == Teuchos::ScalarTraits<ST>::zero())
+        Y.scale(a, *JV);
+      else
+        Y.update(a, *JV, b);
+    }
+
+    //! Returns a character string describing the operator
+    virtual const char * Label() const {
+      return "MatrixFreeJacobianOpT";
+    }
+
+    virtual bool hasTransposeApply() const {
+      return false;
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the domain of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return app->getMapT();
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the range of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return app->getMapT();
+    }
+
+    //@}
+
+  protected:
+
+    static void copy(const Teuchos::RCP<const Tpetra_Vector>& from,
+                     Teuchos::RCP<Tpetra_Vector>& to) {
+      if (Teuchos::is_null(from)) {
+        to = Teuchos::null;
+        return;
+      }
+      if (Teuchos::is_null(to) || !to->getMap()->isSameAs(*from->getMap()))
+        to = Teuchos::rcp(new Tpetra_Vector(from->getMap()));
+      to->update(1.0, *from, 0.0);
+    }
+
+    //! Albany applications
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot
+    double alpha, beta, omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<Tpetra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<Tpetra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<Tpetra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::RCP<Teuchos::Array<ParamVec> > scalar_params;
+
+    //@}
+
+    //! Work space for the product
+    mutable Teuchos::RCP<Tpetra_MultiVector> JV;
+
+  }; // class MatrixFreeJacobianOpT
+
+} // namespace Albany
+
+#endif // ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
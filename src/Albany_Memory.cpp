@@ -26,13 +26,57 @@
 
 namespace Albany {
 namespace {
-class MemoryAnalyzer {
 #ifdef HAVE_TEUCHOS_LONG_LONG_INT
-  typedef long long int Int;
+typedef long long int Int;
 #else
-  typedef int Int;
+typedef int Int;
 #endif
 
+// Min, median, and max over ranks of each of the n fields in d, which holds
+// n values per rank.
+struct Stats {
+  std::vector<Int> min, min_i, med, max, max_i;
+};
+
+void calcStats (const std::vector<Int>& d, const int n, Stats& stats) {
+  const int nproc = d.size() / n;
+  stats.min.assign(n, 0); stats.min_i.assign(n, 0); stats.med.assign(n, 0);
+  stats.max.assign(n, 0); stats.max_i.assign(n, 0);
+  const Int* pd = &d[0];
+  for (int i = 0; i < nproc; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (i == 0 || pd[j] < stats.min[j]) {
+        stats.min[j] = pd[j];
+        stats.min_i[j] = i;
+      }
+      if (i == 0 || pd[j] > stats.max[j]) {
+        stats.max[j] = pd[j];
+        stats.max_i[j] = i;
+      }
+    }
+    pd += n;
+  }
+  for (int j = 0; j < n; ++j) {
+    std::vector<Int> v(nproc);
+    for (int i = 0; i < v.size(); ++i) v[i] = d[n*i + j];
+    std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
+    stats.med[j] = v[v.size()/2];
+  }
+}
+
+void printStatsRow (std::stringstream& msg, const char* name,
+                    const Stats& stats, const int j) {
+  if (stats.min[j] == 0 && stats.med[j] == 0 && stats.max[j] == 0) return;
+  msg << std::setw(16) << name << " "
+      << std::setw(15) << stats.min[j] << " " << std::setw(4)
+      << stats.min_i[j] << " "
+      << std::setw(15) << stats.med[j] << " "
+      << std::setw(15) << stats.max[j] << " " << std::setw(4)
+      << stats.max_i[j] << " "
+      << std::endl;
+}
+
+class MemoryAnalyzer {
   enum {
     // mallinfo
     mi_arena = 0, mi_ordblks, mi_smblks, mi_hblks, mi_hblkhd,
@@ -49,9 +93,7 @@ class MemoryAnalyzer {
   Teuchos::RCP< const Teuchos::Comm<int> > comm_;
   static const int ndata_ = gms_mmap + 1;
   Int data_[ndata_];
-  struct {
-    Int min[ndata_], min_i[ndata_], med[ndata_], max[ndata_], max_i[ndata_];
-  } stats_;
+  Stats stats_;
 
   static void collectMallinfo (Int* data) {
 #ifdef ALBANY_HAVE_MALLINFO
@@ -95,37 +137,25 @@ class MemoryAnalyzer {
 #endif    
   }
 
-  void calcStats (const std::vector<Int>& d) {
-    if (comm_->getRank() != 0) return;
-
-    const Int* pd = &d[0];
-    const int nproc = d.size() / ndata_;
-    for (int i = 0; i < nproc; ++i) {
-      for (int j = 0; j < ndata_; ++j) {
-        if (i == 0 || pd[j] < stats_.min[j]) {
-          stats_.min[j] = pd[j];
-          stats_.min_i[j] = i;
-        }
-        if (i == 0 || pd[j] > stats_.max[j]) {
-          stats_.max[j] = pd[j];
-          stats_.max_i[j] = i;
-        }
-      }
-      pd += ndata_;
-    }
-    for (int j = 0; j < ndata_; ++j) {
-      std::vector<Int> v(nproc);
-      for (int i = 0; i < v.size(); ++i) v[i] = d[ndata_*i + j];
-      std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
-      stats_.med[j] = v[v.size()/2];
-    }    
-  }
-
 public:
   MemoryAnalyzer (const Teuchos::RCP< const Teuchos::Comm<int> >& comm)
     : comm_(comm)
   {}
 
+  // In-use heap and process high-water mark, in KB, from whichever sources are
+  // enabled; 0 if none is.
+  static void sample (Int& heap, Int& maxrss) {
+    Int data[ndata_];
+    for (int j = 0; j < ndata_; ++j) data[j] = 0;
+    collectMallinfo(data);
+    collectGetrusage(data);
+    collectKernelGetMemorySize(data);
+    heap = data[mi_uordblks] + data[mi_hblkhd];
+    if (heap == 0) heap = data[gms_heap];
+    heap /= 1024;
+    maxrss = data[ru_maxrss];
+  }
+
   void collect () {
     for (int j = 0; j < ndata_; ++j) data_[j] = 0;
 
@@ -136,24 +166,13 @@ public:
     std::vector<Int> d;
     if (comm_->getRank() == 0) d.resize(ndata_*comm_->getSize(), 0);
     Teuchos::gather<int, Int>(data_, ndata_, &d[0], ndata_, 0, *comm_);
-    calcStats(d);
+    if (comm_->getRank() == 0) calcStats(d, ndata_, stats_);
   }
 
   void print (std::ostream& os) {
     if (comm_->getRank() != 0) return;
     std::stringstream msg;
-#define smsg(name) do {                                                 \
-      if (stats_.min[name] != 0 || stats_.med[name] != 0 ||             \
-          stats_.max[name] != 0) {                                      \
-        msg << std::setw(16) << #name << " "                            \
-            << std::setw(15) << stats_.min[name] << " " << std::setw(4) \
-            << stats_.min_i[name] << " "                                \
-            << std::setw(15) << stats_.med[name] << " "                 \
-            << std::setw(15) << stats_.max[name] << " " << std::setw(4) \
-            << stats_.max_i[name] << " "                                \
-            << std::endl;                                               \
-      }                                                                 \
-    } while (0)
+#define smsg(name) printStatsRow(msg, #name, stats_, name)
 
     msg << ">>> Albany Memory Analysis" << std::endl;
     msg << "    #ranks: " << comm_->getSize() << std::endl;
@@ -176,6 +195,88 @@ public:
     os << msg.str();
   }
 };
+
+class PhaseTracker {
+  enum { calls = 0, heap, heap_delta, maxrss, maxrss_increase, nfield };
+
+  struct Phase {
+    Phase () : depth(0), heap0(0), maxrss0(0) {
+      for (int j = 0; j < nfield; ++j) data[j] = 0;
+    }
+    int depth;
+    Int heap0, maxrss0;
+    Int data[nfield];
+  };
+
+  bool enabled_;
+  Phase phases_[MEMORY_PHASE_COUNT];
+
+  static const char* name (const int phase) {
+    static const char* names[] = {
+      "mesh read", "discretization setup", "graph construction",
+      "Jacobian fill", "preconditioner setup", "output" };
+    return names[phase];
+  }
+
+public:
+  PhaseTracker () : enabled_(false) {}
+
+  void enable (const bool enable) { enabled_ = enable; }
+  bool enabled () const { return enabled_; }
+
+  void begin (const MemoryPhase phase) {
+    if (!enabled_) return;
+    Phase& p = phases_[phase];
+    if (p.depth++ > 0) return;
+    MemoryAnalyzer::sample(p.heap0, p.maxrss0);
+  }
+
+  void end (const MemoryPhase phase) {
+    if (!enabled_) return;
+    Phase& p = phases_[phase];
+    if (p.depth == 0 || --p.depth > 0) return;
+    Int heap1, maxrss1;
+    MemoryAnalyzer::sample(heap1, maxrss1);
+    const Int delta = heap1 - p.heap0;
+    if (p.data[calls] == 0 || delta > p.data[heap_delta])
+      p.data[heap_delta] = delta;
+    ++p.data[calls];
+    p.data[heap] = heap1;
+    p.data[maxrss] = std::max(p.data[maxrss], maxrss1);
+    p.data[maxrss_increase] += maxrss1 - p.maxrss0;
+  }
+
+  void print (std::ostream& os,
+              const Teuchos::RCP< const Teuchos::Comm<int> >& comm) const {
+    const int n = nfield*MEMORY_PHASE_COUNT;
+    std::vector<Int> data(n), d;
+    for (int i = 0; i < MEMORY_PHASE_COUNT; ++i)
+      for (int j = 0; j < nfield; ++j)
+        data[nfield*i + j] = phases_[i].data[j];
+    if (comm->getRank() == 0) d.resize(n*comm->getSize(), 0);
+    Teuchos::gather<int, Int>(&data[0], n, &d[0], n, 0, *comm);
+    if (comm->getRank() != 0) return;
+
+    Stats stats;
+    calcStats(d, n, stats);
+    std::stringstream msg;
+    msg << ">>> Albany Memory Analysis by Phase" << std::endl;
+    msg << "           field             min proc          median"
+      "             max proc" << std::endl;
+    for (int i = 0; i < MEMORY_PHASE_COUNT; ++i) {
+      if (stats.max[nfield*i + calls] == 0) continue;
+      msg << "  " << name(i) << std::endl;
+#define smsg(field, label) printStatsRow(msg, label, stats, nfield*i + field)
+      smsg(calls, "calls"); smsg(heap, "heap"); smsg(heap_delta, "heap delta");
+      smsg(maxrss, "maxrss"); smsg(maxrss_increase, "maxrss increase");
+#undef smsg
+    }
+    msg << "<<< Albany Memory Analysis by Phase" << std::endl;
+    os << msg.str();
+  }
+};
+
+PhaseTracker phaseTracker;
 } // namespace
 
 void printMemoryAnalysis (
@@ -184,6 +285,19 @@ void printMemoryAnalysis (
   MemoryAnalyzer ma(comm);
   ma.collect();
   ma.print(os);
+  if (phaseTracker.enabled()) phaseTracker.print(os, comm);
+}
+
+void setMemoryPhaseTracking (const bool enable) {
+  phaseTracker.enable(enable);
+}
+
+void beginMemoryPhase (const MemoryPhase phase) {
+  phaseTracker.begin(phase);
+}
+
+void endMemoryPhase (const MemoryPhase phase) {
+  phaseTracker.end(phase);
 }
 
 } // namespace Albany
@@ -49,6 +49,51 @@ namespace Albany {
  */
 void printMemoryAnalysis(
   std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm);
+
+/*! \brief Phases of a run for which memory use is tracked.
+ *
+ *  When "Analyze Memory" is set, memory is sampled on each rank at the
+ *  beginning and end of each phase, without communication. For each phase,
+ *  printMemoryAnalysis then reports min, median, and max over ranks of
+ *
+ *    calls            number of times the phase ran;
+ *    heap             in-use heap at the end of the phase (mallinfo
+ *                     uordblks + hblkhd, else Kernel_GetMemorySize heap), KB;
+ *    heap delta       largest growth of the in-use heap over one call, KB;
+ *    maxrss           process high-water mark (getrusage) at the end of the
+ *                     phase, KB on Linux;
+ *    maxrss increase  total growth of the high-water mark during the phase.
+ *
+ *  The phase with the largest maxrss increase is the one that sets the
+ *  per-node memory requirement. Nested phases (e.g., graph construction
+ *  within discretization setup) are counted in both. A phase entered again
+ *  while active is counted once.
+ */
+enum MemoryPhase {
+  MEMORY_PHASE_MESH_READ = 0,
+  MEMORY_PHASE_DISCRETIZATION_SETUP,
+  MEMORY_PHASE_GRAPH_CONSTRUCTION,
+  MEMORY_PHASE_JACOBIAN_FILL,
+  MEMORY_PHASE_PRECONDITIONER_SETUP,
+  MEMORY_PHASE_OUTPUT,
+  MEMORY_PHASE_COUNT
+};
+
+//! Turn per-phase tracking on or off. It is off by default.
+void setMemoryPhaseTracking(const bool enable);
+void beginMemoryPhase(const MemoryPhase phase);
+void endMemoryPhase(const MemoryPhase phase);
+
+//! Tracks a phase over its lifetime.
+class MemoryPhaseGuard {
+public:
+  explicit MemoryPhaseGuard (const MemoryPhase phase)
+    : phase_(phase)
+  { beginMemoryPhase(phase_); }
+  ~MemoryPhaseGuard () { endMemoryPhase(phase_); }
+private:
+  const MemoryPhase phase_;
+};
 }
 
 #endif // ALBANY_MEMORY_HPP
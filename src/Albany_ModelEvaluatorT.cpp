@@ -8,9 +8,14 @@
 
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DistributedParameterDerivativeOpT.hpp"
+#include "Albany_MatrixFreeJacobianOpT.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
+#include "Thyra_DefaultPreconditioner.hpp"
+#ifdef ALBANY_IFPACK2
+#include "Ifpack2_Factory.hpp"
+#endif
 
 
 //IK, 4/24/15: adding option to write the mass matrix to matrix market file, which is needed
@@ -23,7 +28,7 @@
 Albany::ModelEvaluatorT::ModelEvaluatorT(
     const Teuchos::RCP<Albany::Application>& app_,
     const Teuchos::RCP<Teuchos::ParameterList>& appParams)
-: app(app_), supports_xdot(false), supports_xdotdot(false)
+: app(app_), supports_xdot(false), supports_xdotdot(false), matrix_free(false)
 {
 
   Teuchos::RCP<Teuchos::FancyOStream> out =
@@ -207,6 +212,49 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
     }
   }
 
+  // Matrix-free W, optionally preconditioned from an assembled W
+  matrix_free = problemParams.get("Matrix-Free Jacobian", false);
+  mf_prec_type = problemParams.get<std::string>("Matrix-Free Preconditioner", "None");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    mf_prec_type != "None" && mf_prec_type != "Ifpack2",
+    Teuchos::Exceptions::InvalidParameter,
+    std::endl << "Error!  In Albany::ModelEvaluatorT constructor:  " <<
+    "Unknown Matrix-Free Preconditioner " << mf_prec_type <<
+    ", valid options are None and Ifpack2" << std::endl);
+#ifndef ALBANY_IFPACK2
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    mf_prec_type == "Ifpack2",
+    Teuchos::Exceptions::InvalidParameter,
+    std::endl << "Error!  In Albany::ModelEvaluatorT constructor:  " <<
+    "Matrix-Free Preconditioner Ifpack2 requires Albany built with Ifpack2" << std::endl);
+#endif
+  mf_ifpack2_type = problemParams.get<std::string>("Matrix-Free Ifpack2 Type", "RILUK");
+  mf_ifpack2_params = problemParams.sublist("Matrix-Free Ifpack2 Parameters");
+
+  if (matrix_free) {
+    *out << "Jacobian applied matrix-free, preconditioner = " << mf_prec_type << std::endl;
+
+    // Stratimikos cannot build a preconditioner from the matrix-free
+    // operator; the preconditioner, if any, comes from create_W_prec().
+    Teuchos::ParameterList& piroParams = appParams->sublist("Piro");
+    if (piroParams.isSublist("NOX")) {
+      Teuchos::ParameterList& noxParams = piroParams.sublist("NOX");
+      if (noxParams.isSublist("Direction") &&
+          noxParams.sublist("Direction").isSublist("Newton") &&
+          noxParams.sublist("Direction").sublist("Newton").isSublist("Stratimikos Linear Solver")) {
+        Teuchos::ParameterList& stratParams = noxParams.sublist("Direction").sublist("Newton")
+          .sublist("Stratimikos Linear Solver").sublist("Stratimikos");
+        if (stratParams.isParameter("Preconditioner Type") &&
+            stratParams.get<std::string>("Preconditioner Type") != "None")
+          *out << "Warning: Stratimikos Preconditioner Type "
+               << stratParams.get<std::string>("Preconditioner Type")
+               << " is replaced by None, since it needs an assembled Jacobian."
+               << " Use Matrix-Free Preconditioner instead." << std::endl;
+        stratParams.set<std::string>("Preconditioner Type", "None");
+      }
+    }
+  }
+
   timer = Teuchos::TimeMonitor::getNewTimer("Albany: **Total Fill Time**");
 
 }
@@ -324,6 +372,13 @@ Albany::ModelEvaluatorT::get_p_names(int l) const
 Thyra::ModelEvaluatorBase::InArgs<ST>
 Albany::ModelEvaluatorT::getNominalValues() const
 {
+  // A warm-start guess set on the application replaces the initial solution
+  const Teuchos::RCP<const Tpetra_Vector> guessT = app->getInitialGuessT();
+  if (Teuchos::nonnull(guessT)) {
+    Thyra::ModelEvaluatorBase::InArgs<ST> result = nominalValues;
+    result.set_x(Thyra::createConstVector(guessT, this->get_x_space()));
+    return result;
+  }
   return nominalValues;
 }
 
@@ -345,6 +400,12 @@ Albany::ModelEvaluatorT::getUpperBounds() const
 Teuchos::RCP<Thyra::LinearOpBase<ST> >
 Albany::ModelEvaluatorT::create_W_op() const
 {
+  if (matrix_free) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+      Teuchos::rcp(new MatrixFreeJacobianOpT(app));
+    return Thyra::createLinearOp(W);
+  }
+
   const Teuchos::RCP<Tpetra_Operator> W =
     Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -354,10 +415,40 @@ Albany::ModelEvaluatorT::create_W_op() const
 Teuchos::RCP<Thyra::PreconditionerBase<ST> >
 Albany::ModelEvaluatorT::create_W_prec() const
 {
-  // TODO: Analog of EpetraExt::ModelEvaluator::Preconditioner does not exist in Thyra yet!
-  const bool W_prec_not_supported = true;
+  // Only the matrix-free W has a preconditioner; an assembled W is
+  // preconditioned by the Stratimikos linear solver.
+  const bool W_prec_not_supported = !matrix_free || mf_prec_type == "None";
   TEUCHOS_TEST_FOR_EXCEPT(W_prec_not_supported);
-  return Teuchos::null;
+
+  if (matrixFreePreconditionerIsStale())
+    createMatrixFreePreconditioner();
+
+  const Teuchos::RCP<Thyra::DefaultPreconditioner<ST> > W_prec =
+    Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
+  W_prec->initializeRight(Thyra::createLinearOp(mf_prec));
+  return W_prec;
+}
+
+void
+Albany::ModelEvaluatorT::createMatrixFreePreconditioner() const
+{
+#ifdef ALBANY_IFPACK2
+  mf_prec_jac = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+
+  typedef Ifpack2::Preconditioner<ST, LO, GO, KokkosNode> IfpackPrec;
+  Ifpack2::Factory factory;
+  const Teuchos::RCP<IfpackPrec> prec =
+    factory.create<Tpetra_RowMatrix>(mf_ifpack2_type, mf_prec_jac);
+  prec->setParameters(mf_ifpack2_params);
+  mf_prec = prec;
+#endif
+}
+
+bool
+Albany::ModelEvaluatorT::matrixFreePreconditionerIsStale() const
+{
+  return Teuchos::is_null(mf_prec) ||
+    mf_prec_jac->getCrsGraph().get() != app->getJacobianGraphT().get();
 }
 
 Teuchos::RCP<Thyra::LinearOpBase<ST> >
@@ -459,6 +550,8 @@ Albany::ModelEvaluatorT::createOutArgsImpl() const
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_f, true);
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_op, true);
+  result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec,
+      matrix_free && mf_prec_type != "None");
   result.set_W_properties(
       Thyra::ModelEvaluatorBase::DerivativeProperties(
         Thyra::ModelEvaluatorBase::DERIV_LINEARITY_UNKNOWN,
@@ -606,12 +699,23 @@ Albany::ModelEvaluatorT::evalModelImpl(
     Teuchos::null;
 #endif
 
-  // Cast W to a CrsMatrix, throw an exception if this fails
-  const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
+  // Matrix-free W, if requested
+  const Teuchos::RCP<MatrixFreeJacobianOpT> W_op_out_mfT =
     Teuchos::nonnull(W_op_outT) ?
+    Teuchos::rcp_dynamic_cast<MatrixFreeJacobianOpT>(W_op_outT) :
+    Teuchos::null;
+
+  // Otherwise cast W to a CrsMatrix, throw an exception if this fails
+  const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
+    Teuchos::nonnull(W_op_outT) && Teuchos::is_null(W_op_out_mfT) ?
     Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true) :
     Teuchos::null;
 
+  const Teuchos::RCP<Thyra::PreconditionerBase<ST> > W_prec_out =
+    outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) ?
+    outArgsT.get_W_prec() :
+    Teuchos::null;
+
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
   //IK, 4/24/15: adding object to hold mass matrix to be written to matrix market file
   const Teuchos::RCP<Tpetra_CrsMatrix> Mass_crs =
@@ -644,6 +748,33 @@ Albany::ModelEvaluatorT::evalModelImpl(
 #endif
   }
 
+  // Matrix-free W: keep the point for its products; f is computed below
+  if (Teuchos::nonnull(W_op_out_mfT)) {
+    W_op_out_mfT->set(alpha, beta, omega, curr_time, x_dotT, x_dotdotT, xT,
+                      Teuchos::rcpFromRef(sacado_param_vec));
+  }
+
+  // Preconditioner of the matrix-free W, computed from the assembled W
+  if (Teuchos::nonnull(W_prec_out)) {
+    if (matrixFreePreconditionerIsStale()) {
+      // The Jacobian graph changed since W_prec_out was created
+      createMatrixFreePreconditioner();
+      Teuchos::rcp_dynamic_cast<Thyra::DefaultPreconditioner<ST> >(W_prec_out, true)
+        ->initializeRight(Thyra::createLinearOp(mf_prec));
+    }
+    app->computeGlobalJacobianT(
+        alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(), *xT,
+        sacado_param_vec, fT_out.get(), *mf_prec_jac);
+    f_already_computed = true;
+#ifdef ALBANY_IFPACK2
+    // The symbolic setup needs the filled matrix, so it is done here once
+    const Teuchos::RCP<Ifpack2::Preconditioner<ST, LO, GO, KokkosNode> > prec =
+      Teuchos::rcp_dynamic_cast<Ifpack2::Preconditioner<ST, LO, GO, KokkosNode> >(mf_prec, true);
+    if (!prec->isInitialized()) prec->initialize();
+    prec->compute();
+#endif
+  }
+
   // df/dp
   for (int l = 0; l < outArgsT.Np(); ++l) {
     const Teuchos::RCP<Thyra::MultiVectorBase<ST> > dfdp_out =
@@ -144,6 +144,29 @@ private:
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
 
+  //! Apply W matrix-free through the Tangent evaluation type
+  bool matrix_free;
+
+  //! Preconditioner of the matrix-free W: "None" or "Ifpack2"
+  std::string mf_prec_type;
+
+  //! Ifpack2 type and parameters of the matrix-free preconditioner
+  std::string mf_ifpack2_type;
+  Teuchos::ParameterList mf_ifpack2_params;
+
+  //! Assembled W the matrix-free preconditioner is computed from
+  mutable Teuchos::RCP<Tpetra_CrsMatrix> mf_prec_jac;
+
+  //! Matrix-free preconditioner
+  mutable Teuchos::RCP<Tpetra_Operator> mf_prec;
+
+  //! (Re)create mf_prec_jac and mf_prec on the current Jacobian graph
+  void createMatrixFreePreconditioner() const;
+
+  //! True if mf_prec_jac is not on the current Jacobian graph, e.g., after
+  //! the mesh was adapted
+  bool matrixFreePreconditionerIsStale() const;
+
 };
 
 }
@@ -0,0 +1,269 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_SGBlockExporter.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "Epetra_Comm.h"
+#include "Epetra_CrsGraph.h"
+#include "Epetra_Map.h"
+
+namespace {
+
+// The first n blocks of v as the columns of one multivector, or null if empty
+template <typename MV>
+Teuchos::RCP<Epetra_MultiVector>
+columns(const Stokhos::ProductContainer<MV>& v, const int n)
+{
+  std::vector<double*> cols;
+  for (int i = 0; i < n; ++i) {
+    const Epetra_MultiVector& block = v[i];
+    double** values;
+    block.ExtractView(&values);
+    cols.insert(cols.end(), values, values + block.NumVectors());
+  }
+  if (cols.empty()) return Teuchos::null;
+  return Teuchos::rcp(new Epetra_MultiVector(View, v[0].Map(), &cols[0], cols.size()));
+}
+
+template <typename MV>
+void exportColumns(Stokhos::ProductContainer<MV>& dst,
+                   const Stokhos::ProductContainer<MV>& src,
+                   const int n, const Epetra_Export& exporter,
+                   const Epetra_CombineMode mode)
+{
+  const Teuchos::RCP<Epetra_MultiVector> dst_cols = columns(dst, n);
+  const Teuchos::RCP<Epetra_MultiVector> src_cols = columns(src, n);
+  if (Teuchos::nonnull(dst_cols))
+    dst_cols->Export(*src_cols, exporter, mode);
+}
+
+// m repeated n times, with the GIDs of copy i shifted by i*stride
+Epetra_Map stack(const Epetra_BlockMap& m, const int n, const int stride)
+{
+  const int num = m.NumMyElements();
+  std::vector<int> gids(n*num);
+  for (int i = 0; i < n; ++i)
+    for (int k = 0; k < num; ++k)
+      gids[i*num + k] = m.GID(k) + i*stride;
+  return Epetra_Map(-1, gids.size(), gids.empty() ? NULL : &gids[0],
+                    m.IndexBase(), m.Comm());
+}
+
+// Block diagonal graph with n copies of g. The column indices of each row
+// keep their order, so the values of a row can be copied between a block
+// and its copy as they are.
+Teuchos::RCP<Epetra_CrsGraph>
+stack(const Epetra_CrsGraph& g, const int n,
+      const Epetra_Map& rowMap, const Epetra_Map& colMap,
+      const Epetra_BlockMap& domainMap, const Epetra_BlockMap& rangeMap)
+{
+  const int rows = g.NumMyRows();
+  const int cols = g.ColMap().NumMyElements();
+
+  std::vector<int> lengths(n*rows);
+  for (int i = 0; i < n; ++i)
+    for (int r = 0; r < rows; ++r)
+      lengths[i*rows + r] = g.NumMyIndices(r);
+
+  const Teuchos::RCP<Epetra_CrsGraph> s =
+    Teuchos::rcp(new Epetra_CrsGraph(Copy, rowMap, colMap,
+                                     lengths.empty() ? NULL : &lengths[0], true));
+  std::vector<int> shifted;
+  for (int i = 0; i < n; ++i)
+    for (int r = 0; r < rows; ++r) {
+      int num;
+      int* indices;
+      g.ExtractMyRowView(r, num, indices);
+      shifted.resize(num);
+      for (int k = 0; k < num; ++k) shifted[k] = indices[k] + i*cols;
+      s->InsertMyIndices(i*rows + r, num, shifted.empty() ? NULL : &shifted[0]);
+    }
+  s->FillComplete(domainMap, rangeMap);
+  return s;
+}
+
+// True if the local elements of a and b have the same GIDs in the same order.
+// Local only, unlike SameAs, so that it can be called on some processes.
+bool sameLocalMap(const Epetra_BlockMap& a, const Epetra_BlockMap& b)
+{
+  if (a.DataPtr() == b.DataPtr()) return true;
+  const int num = a.NumMyElements();
+  if (b.NumMyElements() != num) return false;
+  for (int k = 0; k < num; ++k)
+    if (a.GID(k) != b.GID(k)) return false;
+  return true;
+}
+
+// True if the local rows of a and b have the same row and column GIDs and
+// the same column indices, so that values can be copied by position
+bool sameLocalGraph(const Epetra_CrsGraph& a, const Epetra_CrsGraph& b)
+{
+  if (a.DataPtr() == b.DataPtr()) return true;
+  if (a.NumMyNonzeros() != b.NumMyNonzeros() ||
+      !sameLocalMap(a.RowMap(), b.RowMap()) ||
+      !sameLocalMap(a.ColMap(), b.ColMap()))
+    return false;
+  for (int r = 0; r < a.NumMyRows(); ++r) {
+    int num_a, num_b;
+    int *indices_a, *indices_b;
+    a.ExtractMyRowView(r, num_a, indices_a);
+    b.ExtractMyRowView(r, num_b, indices_b);
+    if (num_a != num_b || !std::equal(indices_a, indices_a + num_a, indices_b))
+      return false;
+  }
+  return true;
+}
+
+// Copies the values of rows from_row.. of a into rows to_row.. of b
+void copyRows(const Epetra_CrsMatrix& a, const int from_row,
+              Epetra_CrsMatrix& b, const int to_row, const int rows)
+{
+  for (int r = 0; r < rows; ++r) {
+    int num_a, num_b;
+    double *values_a, *values_b;
+    a.ExtractMyRowView(from_row + r, num_a, values_a);
+    b.ExtractMyRowView(to_row + r, num_b, values_b);
+    std::copy(values_a, values_a + num_a, values_b);
+  }
+}
+
+}
+
+Albany::SGBlockExporter::SGBlockExporter(const bool stack_) :
+  stack(stack_),
+  stackable(false)
+{
+}
+
+void
+Albany::SGBlockExporter::importBlocks(
+    Stokhos::ProductContainer<Epetra_Vector>& dst,
+    const Stokhos::ProductContainer<Epetra_Vector>& src,
+    const int n, const Epetra_Import& importer,
+    const Epetra_CombineMode mode)
+{
+  const Teuchos::RCP<Epetra_MultiVector> dst_cols = columns(dst, n);
+  const Teuchos::RCP<Epetra_MultiVector> src_cols = columns(src, n);
+  if (Teuchos::nonnull(dst_cols))
+    dst_cols->Import(*src_cols, importer, mode);
+}
+
+void
+Albany::SGBlockExporter::exportBlocks(
+    Stokhos::ProductContainer<Epetra_Vector>& dst,
+    const Stokhos::ProductContainer<Epetra_Vector>& src,
+    const int n, const Epetra_Export& exporter,
+    const Epetra_CombineMode mode)
+{
+  exportColumns(dst, src, n, exporter, mode);
+}
+
+void
+Albany::SGBlockExporter::exportBlocks(
+    Stokhos::ProductContainer<Epetra_MultiVector>& dst,
+    const Stokhos::ProductContainer<Epetra_MultiVector>& src,
+    const int n, const Epetra_Export& exporter,
+    const Epetra_CombineMode mode)
+{
+  exportColumns(dst, src, n, exporter, mode);
+}
+
+bool
+Albany::SGBlockExporter::setup(
+    const Stokhos::ProductContainer<Epetra_CrsMatrix>& dst,
+    const Stokhos::ProductContainer<Epetra_CrsMatrix>& src)
+{
+  const int n = dst.size();
+  if (!stack || n == 0 || src.size() != n) return false;
+
+  const Epetra_CrsGraph& og = src[0].Graph();
+  const Epetra_CrsGraph& g = dst[0].Graph();
+
+  // The decision to rebuild must be the same on every process
+  int changed = n != dst_blocks.size();
+  for (int i = 0; !changed && i < n; ++i)
+    changed = src.getCoeffPtr(i) != src_blocks[i] || dst.getCoeffPtr(i) != dst_blocks[i];
+  int any_changed;
+  g.Comm().MaxAll(&changed, &any_changed, 1);
+  if (!any_changed) return stackable;
+
+  src_blocks.resize(n);
+  dst_blocks.resize(n);
+  for (int i = 0; i < n; ++i) {
+    src_blocks[i] = src.getCoeffPtr(i);
+    dst_blocks[i] = dst.getCoeffPtr(i);
+  }
+  overlapped = Teuchos::null;
+  owned = Teuchos::null;
+  exporter = Teuchos::null;
+
+  // All blocks must have the graph of the first one, on every process;
+  // the values are copied between the blocks and the stacked matrices by
+  // position
+  int ok = og.Filled() && og.Sorted() && g.Filled() && g.Sorted();
+  for (int i = 1; ok && i < n; ++i)
+    ok = sameLocalGraph(src[i].Graph(), og) && sameLocalGraph(dst[i].Graph(), g);
+  int all_ok;
+  g.Comm().MinAll(&ok, &all_ok, 1);
+  stackable = all_ok;
+  if (!stackable) return false;
+
+  const Epetra_BlockMap* maps[] = { &og.RowMap(), &og.ColMap(), &g.RowMap(),
+                                    &g.ColMap(), &g.DomainMap(), &g.RangeMap() };
+  int min_gid = INT_MAX, max_gid = INT_MIN;
+  for (int k = 0; k < 6; ++k) {
+    min_gid = std::min(min_gid, maps[k]->MinAllGID());
+    max_gid = std::max(max_gid, maps[k]->MaxAllGID());
+  }
+  const long long stride = static_cast<long long>(max_gid) + 1;
+  stackable = min_gid >= 0 && stride * n <= INT_MAX;
+  if (!stackable) return false;
+  const int shift = static_cast<int>(stride);
+
+  const Epetra_Map domainMap = stack(g.DomainMap(), n, shift);
+  const Epetra_Map rangeMap = stack(g.RangeMap(), n, shift);
+  const Epetra_Map ownedRowMap = stack(g.RowMap(), n, shift);
+  const Epetra_Map overlapRowMap = stack(og.RowMap(), n, shift);
+
+  overlapped = Teuchos::rcp(new Epetra_CrsMatrix(Copy,
+      *stack(og, n, overlapRowMap, stack(og.ColMap(), n, shift), domainMap, rangeMap)));
+  owned = Teuchos::rcp(new Epetra_CrsMatrix(Copy,
+      *stack(g, n, ownedRowMap, stack(g.ColMap(), n, shift), domainMap, rangeMap)));
+  exporter = Teuchos::rcp(new Epetra_Export(overlapRowMap, ownedRowMap));
+
+  return true;
+}
+
+void
+Albany::SGBlockExporter::exportMatrices(
+    Stokhos::ProductContainer<Epetra_CrsMatrix>& dst,
+    const Stokhos::ProductContainer<Epetra_CrsMatrix>& src,
+    const Epetra_Export& blockExporter)
+{
+  if (!setup(dst, src)) {
+    for (int i = 0; i < dst.size(); ++i) {
+      dst[i].PutScalar(0.0);
+      dst[i].Export(src[i], blockExporter, Add);
+    }
+    return;
+  }
+
+  const int n = dst.size();
+  const int src_rows = src[0].NumMyRows();
+  const int dst_rows = dst[0].NumMyRows();
+  for (int i = 0; i < n; ++i)
+    copyRows(src[i], 0, *overlapped, i*src_rows, src_rows);
+
+  owned->PutScalar(0.0);
+  owned->Export(*overlapped, *exporter, Add);
+
+  for (int i = 0; i < n; ++i)
+    copyRows(*owned, i*dst_rows, dst[i], 0, dst_rows);
+}
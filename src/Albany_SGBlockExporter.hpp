@@ -0,0 +1,87 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_SGBLOCKEXPORTER_HPP
+#define ALBANY_SGBLOCKEXPORTER_HPP
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "Epetra_CrsMatrix.h"
+#include "Epetra_Export.h"
+#include "Epetra_Import.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_Vector.h"
+
+#include "Stokhos_ProductContainer.hpp"
+
+namespace Albany {
+
+/** \brief Moves all stochastic Galerkin blocks in one communication round
+ *
+ * The SG fills move every polynomial chaos block between the owned and the
+ * overlapped distribution with the same Epetra_Import or Epetra_Export,
+ * which block by block costs one round of messages per block. Here the
+ * vector blocks are viewed as the columns of one Epetra_MultiVector, and
+ * the matrix blocks are copied into one block diagonal Epetra_CrsMatrix
+ * whose row map is the block row map repeated once per block (with the
+ * GIDs of block i shifted by i times the GID range). Each neighbor then
+ * gets one message holding all blocks.
+ *
+ * The stacked overlapped and owned matrices hold a second copy of the
+ * values of every block, which doubles the memory of the SG Jacobian. They
+ * are built on the first export and rebuilt when the blocks are replaced.
+ * Stacking can be turned off ("Stacked SG Jacobian Export" in the Problem
+ * list) where that memory is not available. If the blocks do not all have
+ * the same sorted, filled graph (same row and column GIDs and column
+ * indices), or the stacked GIDs would overflow int, the matrices are
+ * exported block by block as before.
+ */
+class SGBlockExporter {
+public:
+  explicit SGBlockExporter(const bool stack = true);
+
+  //! dst[i] = src[i] through importer for the first n blocks
+  static void importBlocks(Stokhos::ProductContainer<Epetra_Vector>& dst,
+                           const Stokhos::ProductContainer<Epetra_Vector>& src,
+                           const int n, const Epetra_Import& importer,
+                           const Epetra_CombineMode mode);
+
+  //! dst[i] = src[i] through exporter for the first n blocks
+  static void exportBlocks(Stokhos::ProductContainer<Epetra_Vector>& dst,
+                           const Stokhos::ProductContainer<Epetra_Vector>& src,
+                           const int n, const Epetra_Export& exporter,
+                           const Epetra_CombineMode mode);
+  static void exportBlocks(Stokhos::ProductContainer<Epetra_MultiVector>& dst,
+                           const Stokhos::ProductContainer<Epetra_MultiVector>& src,
+                           const int n, const Epetra_Export& exporter,
+                           const Epetra_CombineMode mode);
+
+  //! Overwrites each block of dst with the sum of the overlapped block of src
+  void exportMatrices(Stokhos::ProductContainer<Epetra_CrsMatrix>& dst,
+                      const Stokhos::ProductContainer<Epetra_CrsMatrix>& src,
+                      const Epetra_Export& exporter);
+
+private:
+  //! Builds the stacked matrices if needed; false if the blocks can't be stacked
+  bool setup(const Stokhos::ProductContainer<Epetra_CrsMatrix>& dst,
+             const Stokhos::ProductContainer<Epetra_CrsMatrix>& src);
+
+  //! Blocks the stacked matrices were built for. Held, so that a new block
+  //! can't be taken for a freed one at the same address.
+  Teuchos::Array<Teuchos::RCP<const Epetra_CrsMatrix> > src_blocks;
+  Teuchos::Array<Teuchos::RCP<const Epetra_CrsMatrix> > dst_blocks;
+  bool stack;
+  bool stackable;
+
+  Teuchos::RCP<Epetra_CrsMatrix> overlapped;
+  Teuchos::RCP<Epetra_CrsMatrix> owned;
+  Teuchos::RCP<Epetra_Export> exporter;
+};
+
+}
+
+#endif // ALBANY_SGBLOCKEXPORTER_HPP
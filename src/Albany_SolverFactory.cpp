@@ -18,6 +18,7 @@
 #endif
 #include "Albany_PiroObserverT.hpp"
 #include "Albany_ModelFactory.hpp"
+#include "Albany_Memory.hpp"
 
 #include "Piro_ProviderBase.hpp"
 
@@ -506,11 +507,64 @@ Albany::SolverFactory::createThyraSolverAndGetAlbanyApp(
 
 namespace {
 
+#ifdef ALBANY_IFPACK2
+// Forwards to a preconditioner factory, tracking the memory used by
+// preconditioner setup.
+template <typename Impl>
+class MemoryTrackingPreconditionerFactory
+  : public Thyra::PreconditionerFactoryBase<ST> {
+public:
+  MemoryTrackingPreconditionerFactory () : impl_(Teuchos::rcp(new Impl)) {}
+
+  bool isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOp) const
+  { return impl_->isCompatible(fwdOp); }
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST> > createPrec () const
+  { return impl_->createPrec(); }
+
+  void initializePrec (
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOp,
+    Thyra::PreconditionerBase<ST>* prec,
+    const Thyra::ESupportSolveUse supportSolveUse) const
+  {
+    Albany::MemoryPhaseGuard memoryPhase(Albany::MEMORY_PHASE_PRECONDITIONER_SETUP);
+    impl_->initializePrec(fwdOp, prec, supportSolveUse);
+  }
+
+  void uninitializePrec (
+    Thyra::PreconditionerBase<ST>* prec,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* fwdOp,
+    Thyra::ESupportSolveUse* supportSolveUse) const
+  { impl_->uninitializePrec(prec, fwdOp, supportSolveUse); }
+
+  void setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+  { impl_->setParameterList(paramList); }
+
+  Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList ()
+  { return impl_->getNonconstParameterList(); }
+
+  Teuchos::RCP<Teuchos::ParameterList> unsetParameterList ()
+  { return impl_->unsetParameterList(); }
+
+  Teuchos::RCP<const Teuchos::ParameterList> getParameterList () const
+  { return impl_->getParameterList(); }
+
+  Teuchos::RCP<const Teuchos::ParameterList> getValidParameters () const
+  { return impl_->getValidParameters(); }
+
+  std::string description () const { return impl_->description(); }
+
+private:
+  const Teuchos::RCP<Impl> impl_;
+};
+#endif
+
 void enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder)
 {
 #ifdef ALBANY_IFPACK2
   typedef Thyra::PreconditionerFactoryBase<ST> Base;
-  typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
+  typedef MemoryTrackingPreconditionerFactory<
+    Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> > Impl;
   linearSolverBuilder.setPreconditioningStrategyFactory(Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
 #endif
 }
@@ -0,0 +1,223 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_WarmStartSolverT.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "Thyra_VectorStdOps.hpp"
+#include "Thyra_NonlinearSolver_NOX.hpp"
+#include "NOX_Solver_Generic.H"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+namespace {
+
+// Installs the warm start guess for one solve and removes it again, also if
+// the solve throws, so that a failed sample does not leave its guess behind
+class InitialGuessGuard {
+public:
+  InitialGuessGuard(Albany::Application& app,
+                    const Teuchos::RCP<const Tpetra_Vector>& guess) :
+    app_(app)
+  { app_.setInitialGuessT(guess); }
+  ~InitialGuessGuard() { app_.setInitialGuessT(Teuchos::null); }
+private:
+  Albany::Application& app_;
+};
+
+}
+
+Albany::WarmStartSolverT::WarmStartSolverT(
+    const Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> >& solver_,
+    const Teuchos::RCP<Albany::Application>& app_,
+    Teuchos::ParameterList& params) :
+  solver(solver_),
+  nox_solver(Teuchos::rcp_dynamic_cast<Piro::NOXSolver<ST> >(solver_)),
+  app(app_)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(nox_solver), std::logic_error,
+    std::endl << "Error!  In Albany::WarmStartSolverT constructor:  " <<
+    "Warm Start requires a steady NOX solve" << std::endl);
+  p_index = params.get("Parameter Vector Index", 0);
+  extrapolate = params.get("Warm Start Extrapolation", false);
+  const int size = params.get("Warm Start History Size", 100);
+  TEUCHOS_TEST_FOR_EXCEPTION(size < 1, Teuchos::Exceptions::InvalidParameter,
+    std::endl << "Error!  In Albany::WarmStartSolverT constructor:  " <<
+    "Warm Start History Size must be positive, not " << size << std::endl);
+  history_size = size;
+
+  // Piro solvers append the solution to the model's responses
+  x_index = solver->Ng() - 1;
+}
+
+Teuchos::RCP<const Thyra::VectorSpaceBase<ST> >
+Albany::WarmStartSolverT::get_p_space(int l) const
+{
+  return solver->get_p_space(l);
+}
+
+Teuchos::RCP<const Thyra::VectorSpaceBase<ST> >
+Albany::WarmStartSolverT::get_g_space(int j) const
+{
+  return solver->get_g_space(j);
+}
+
+Teuchos::RCP<const Teuchos::Array<std::string> >
+Albany::WarmStartSolverT::get_p_names(int l) const
+{
+  return solver->get_p_names(l);
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::WarmStartSolverT::getNominalValues() const
+{
+  return solver->getNominalValues();
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::WarmStartSolverT::getLowerBounds() const
+{
+  return solver->getLowerBounds();
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::WarmStartSolverT::getUpperBounds() const
+{
+  return solver->getUpperBounds();
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::WarmStartSolverT::createInArgs() const
+{
+  const Thyra::ModelEvaluatorBase::InArgs<ST> solverInArgs = solver->createInArgs();
+
+  Thyra::ModelEvaluatorBase::InArgsSetup<ST> result;
+  result.setModelEvalDescription(this->description());
+  result.set_Np(solverInArgs.Np());
+  result.setSupports(solverInArgs);
+  return result;
+}
+
+Thyra::ModelEvaluatorBase::OutArgs<ST>
+Albany::WarmStartSolverT::createOutArgsImpl() const
+{
+  const Thyra::ModelEvaluatorBase::OutArgs<ST> solverOutArgs = solver->createOutArgs();
+
+  Thyra::ModelEvaluatorBase::OutArgsSetup<ST> result;
+  result.setModelEvalDescription(this->description());
+  result.set_Np_Ng(solverOutArgs.Np(), solverOutArgs.Ng());
+  result.setSupports(solverOutArgs);
+  return result;
+}
+
+Teuchos::RCP<const Tpetra_Vector>
+Albany::WarmStartSolverT::initialGuess(const std::vector<ST>& p) const
+{
+  if (history.empty()) return Teuchos::null;
+
+  // Nearest converged sample
+  std::size_t nearest = 0;
+  double min_dist2 = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < history.size(); ++i) {
+    double dist2 = 0.0;
+    for (std::size_t k = 0; k < p.size(); ++k)
+      dist2 += (p[k] - history[i].p[k]) * (p[k] - history[i].p[k]);
+    if (dist2 < min_dist2) {
+      min_dist2 = dist2;
+      nearest = i;
+    }
+  }
+  const Sample& sample = history[nearest];
+
+  const Teuchos::RCP<Tpetra_Vector> guess =
+    Teuchos::rcp(new Tpetra_Vector(*sample.x, Teuchos::Copy));
+  const bool extrapolated = extrapolate && Teuchos::nonnull(sample.dxdp);
+  if (extrapolated)
+    for (std::size_t k = 0; k < p.size(); ++k)
+      guess->update(p[k] - sample.p[k], *sample.dxdp->getVector(k), 1.0);
+
+  const Teuchos::RCP<Teuchos::FancyOStream> out =
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+  *out << "Warm start from the solution at distance " << std::sqrt(min_dist2)
+       << " in parameter space" << (extrapolated ? ", extrapolated with dx/dp" : "")
+       << std::endl;
+
+  return guess;
+}
+
+bool
+Albany::WarmStartSolverT::gradientsRequested(
+    const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const
+{
+  typedef Thyra::ModelEvaluatorBase MEB;
+  for (int j = 0; j < outArgs.Ng(); ++j)
+    if (!outArgs.supports(MEB::OUT_ARG_DgDp, j, p_index).none() &&
+        !outArgs.get_DgDp(j, p_index).isEmpty())
+      return true;
+  return false;
+}
+
+void
+Albany::WarmStartSolverT::evalModelImpl(
+    const Thyra::ModelEvaluatorBase::InArgs<ST>& inArgs,
+    const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const
+{
+  typedef Thyra::ModelEvaluatorBase MEB;
+
+  // Parameter values of this sample
+  Teuchos::RCP<const Thyra::VectorBase<ST> > p_in = inArgs.get_p(p_index);
+  if (Teuchos::is_null(p_in))
+    p_in = solver->getNominalValues().get_p(p_index);
+  const Teuchos::ArrayRCP<const ST> p_view =
+    ConverterT::getConstTpetraVector(p_in)->get1dView();
+  const std::vector<ST> p(p_view.begin(), p_view.end());
+
+  const InitialGuessGuard guard(*app, initialGuess(p));
+
+  // Forward the arguments, also asking for the solution and, if Dakota asked
+  // for gradients and the solver can compute it, dx/dp
+  MEB::InArgs<ST> solverInArgs = solver->createInArgs();
+  solverInArgs.setArgs(inArgs);
+  MEB::OutArgs<ST> solverOutArgs = solver->createOutArgs();
+  solverOutArgs.setArgs(outArgs);
+
+  Teuchos::RCP<Thyra::VectorBase<ST> > x = solverOutArgs.get_g(x_index);
+  if (Teuchos::is_null(x)) {
+    x = Thyra::createMember(solver->get_g_space(x_index));
+    solverOutArgs.set_g(x_index, x);
+  }
+
+  Teuchos::RCP<Thyra::MultiVectorBase<ST> > dxdp;
+  if (extrapolate && gradientsRequested(outArgs) &&
+      solverOutArgs.supports(MEB::OUT_ARG_DgDp, x_index, p_index).supports(MEB::DERIV_MV_JACOBIAN_FORM)) {
+    const MEB::Derivative<ST> requested = solverOutArgs.get_DgDp(x_index, p_index);
+    if (requested.isEmpty()) {
+      dxdp = Thyra::createMembers(solver->get_g_space(x_index), p.size());
+      solverOutArgs.set_DgDp(x_index, p_index,
+          MEB::DerivativeMultiVector<ST>(dxdp, MEB::DERIV_MV_JACOBIAN_FORM));
+    }
+    else if (requested.getMultiVectorOrientation() == MEB::DERIV_MV_JACOBIAN_FORM)
+      dxdp = requested.getMultiVector();
+  }
+
+  solver->evalModel(solverInArgs, solverOutArgs);
+
+  // Keep only converged solutions; the last iterate of a failed solve is
+  // no better a guess than the nominal one
+  if (nox_solver->getSolver()->getNOXSolver()->getStatus() != NOX::StatusTest::Converged)
+    return;
+
+  Sample sample;
+  sample.p = p;
+  sample.x = Teuchos::rcp(new Tpetra_Vector(*ConverterT::getConstTpetraVector(x), Teuchos::Copy));
+  if (Teuchos::nonnull(dxdp))
+    sample.dxdp = Teuchos::rcp(new Tpetra_MultiVector(*ConverterT::getConstTpetraMultiVector(dxdp), Teuchos::Copy));
+
+  history.push_back(sample);
+  if (history.size() > history_size) history.pop_front();
+}
@@ -0,0 +1,101 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_WARMSTARTSOLVERT_HPP
+#define ALBANY_WARMSTARTSOLVERT_HPP
+
+#include <deque>
+#include <vector>
+
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+#include "Piro_NOXSolver.hpp"
+
+#include "Albany_DataTypes.hpp"
+#include "Albany_Application.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+/** \brief Response-only solver that warm starts each solve from earlier ones
+ *
+ * Wraps a Piro NOX solver, whose last response is the solution. The
+ * solution of every solve that NOX reports converged is stored with its
+ * parameter values. A solve at a new parameter point starts from the
+ * solution stored for the nearest point in parameter space. Parameters are
+ * compared in the units of "Parameter Vector Index".
+ *
+ * If "Warm Start Extrapolation" is set, the guess is extrapolated to first
+ * order, x0 = x_near + dx/dp (p - p_near). dx/dp is only kept from samples
+ * for which Dakota asked for gradients, since the sensitivity solve is
+ * then done anyway; asking for it on every sample would add one linear
+ * solve per parameter to each one.
+ *
+ * Parameters (in the Dakota list):
+ *   "Warm Start"                  bool  false
+ *   "Warm Start Extrapolation"    bool  false
+ *   "Warm Start History Size"     int   100
+ */
+class WarmStartSolverT : public Thyra::ResponseOnlyModelEvaluatorBase<ST> {
+public:
+  WarmStartSolverT(
+      const Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> >& solver,
+      const Teuchos::RCP<Albany::Application>& app,
+      Teuchos::ParameterList& params);
+
+  /** \name Overridden from Thyra::ModelEvaluator<ST> . */
+  //@{
+  Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > get_p_space(int l) const;
+  Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > get_g_space(int j) const;
+  Teuchos::RCP<const Teuchos::Array<std::string> > get_p_names(int l) const;
+  Thyra::ModelEvaluatorBase::InArgs<ST> getNominalValues() const;
+  Thyra::ModelEvaluatorBase::InArgs<ST> getLowerBounds() const;
+  Thyra::ModelEvaluatorBase::InArgs<ST> getUpperBounds() const;
+  Thyra::ModelEvaluatorBase::InArgs<ST> createInArgs() const;
+  //@}
+
+  //! Number of stored solutions
+  std::size_t getHistorySize() const { return history.size(); }
+
+private:
+  /** \name Overridden from Thyra::ModelEvaluatorDefaultBase<ST> . */
+  //@{
+  Thyra::ModelEvaluatorBase::OutArgs<ST> createOutArgsImpl() const;
+
+  void evalModelImpl(
+      const Thyra::ModelEvaluatorBase::InArgs<ST>& inArgs,
+      const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const;
+  //@}
+
+  //! A converged solve
+  struct Sample {
+    std::vector<ST> p;
+    Teuchos::RCP<Tpetra_Vector> x;
+    //! dx/dp, one column per parameter; null if not available
+    Teuchos::RCP<Tpetra_MultiVector> dxdp;
+  };
+
+  //! Initial guess for the parameter values p, or null for the nominal one
+  Teuchos::RCP<const Tpetra_Vector> initialGuess(const std::vector<ST>& p) const;
+
+  //! True if outArgs asks for the derivative of a response w.r.t. p_index
+  bool gradientsRequested(const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const;
+
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > solver;
+  Teuchos::RCP<Piro::NOXSolver<ST> > nox_solver;
+  Teuchos::RCP<Albany::Application> app;
+
+  int p_index, x_index;
+  bool extrapolate;
+  std::size_t history_size;
+
+  mutable std::deque<Sample> history;
+};
+
+}
+
+#endif // ALBANY_WARMSTARTSOLVERT_HPP
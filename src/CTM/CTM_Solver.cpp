@@ -46,6 +46,10 @@ namespace CTM {
         } else {
             assert(la_list.get<std::string>("Solver") == "SuperLU_DIST");
         }
+        if (la_list.isParameter("Preconditioner Reuse")) {
+            const std::string reuse = la_list.get<std::string>("Preconditioner Reuse");
+            assert(reuse == "None" || reuse == "Symbolic" || reuse == "Lagged");
+        }
         assert(la_list.isType<double>("Nonlinear Tolerance"));
         assert(la_list.isType<int>("Nonlinear Max. Iterations"));
     }
@@ -211,6 +215,11 @@ namespace CTM {
 
         apf_t_disc->initTemperatureHack();
 
+        // linear solvers, kept across Newton iterations and time steps so that
+        // their preconditioners can be reused
+        LinearSolver t_linear_solver(p);
+        LinearSolver m_linear_solver(p);
+
         // time loop
         double norm;
         *out << std::endl;
@@ -245,7 +254,7 @@ namespace CTM {
                 //
                 du_t->putScalar(0.0);
                 // solve the linear system of equations
-                solve_linear_system(p, J_t, du_t, r_t);
+                t_linear_solver.solve(J_t, du_t, r_t);
                 // update solution
                 u_t->update(1.0, *du_t, 1.0);
                 v_t->update(alpha, *u_t, -alpha, *u_v_t, 0.0);
@@ -285,7 +294,7 @@ namespace CTM {
                 //
                 du_m->putScalar(0.0);
                 // solve the linear system of equations
-                solve_linear_system(p, J_m, du_m, r_m);
+                m_linear_solver.solve(J_m, du_m, r_m);
                 // update solution
                 u_m->update(1.0, *du_m, 1.0);
                 // compute residual
@@ -5,6 +5,7 @@
 #include "Teuchos_FancyOStream.hpp"
 #include "Teuchos_VerboseObject.hpp"
 #include "Teuchos_Describable.hpp"
+#include "Teuchos_TestForException.hpp"
 // Belos
 #include <BelosLinearProblem.hpp>
 #include <BelosBlockGmresSolMgr.hpp>
@@ -48,7 +49,7 @@ namespace CTM {
         return p;
     }
 
-    static RCP<Prec> build_ifpack2_prec(RCP<Tpetra_CrsMatrix> A) {
+    static RCP<IfpackPrec> build_ifpack2_prec(RCP<Tpetra_CrsMatrix> A) {
         RCP<ParameterList> p = get_ifpack2_params();
         Ifpack2::Factory factory;
         RCP<IfpackPrec> prec = factory.create<RM>("ILUT", A);
@@ -58,9 +59,11 @@ namespace CTM {
         return prec;
     }
 
-    static RCP<Prec> build_precond(RCP<const ParameterList> p, RCP<Tpetra_CrsMatrix> A) {
-        (void) (p);
-        return build_ifpack2_prec(A);
+    // The parameter list is const, so defaults can't be set into it.
+    template <typename T>
+    static T get_optional(RCP<const ParameterList> p, const std::string& name,
+            const T& value) {
+        return p->isParameter(name) ? p->get<T>(name) : value;
     }
 
     static RCP<Solver> build_solver(
@@ -77,8 +80,86 @@ namespace CTM {
         return solver;
     }
 
-    void solve_linear_system(
-            RCP<const ParameterList> in,
+    LinearSolver::LinearSolver(RCP<const ParameterList> p) :
+    params(p),
+    reuse(REUSE_NONE),
+    recompute_interval(get_optional<int>(p, "Preconditioner Recompute Interval", 5)),
+    recompute_growth(get_optional<double>(p, "Preconditioner Recompute Iteration Growth", 1.5)),
+    solves_since_compute(0),
+    reference_iters(0) {
+        const std::string policy =
+                get_optional<std::string>(p, "Preconditioner Reuse", "None");
+        if (policy == "Symbolic") reuse = REUSE_SYMBOLIC;
+        else if (policy == "Lagged") reuse = REUSE_LAGGED;
+        else TEUCHOS_TEST_FOR_EXCEPTION(policy != "None", std::logic_error,
+                "Unknown \"Preconditioner Reuse\" option " << policy << std::endl);
+    }
+
+    bool LinearSolver::can_reuse(const Tpetra_CrsMatrix& A) {
+        return reuse != REUSE_NONE && &A == matrix.get() &&
+                A.getCrsGraph() == graph;
+    }
+
+    void LinearSolver::update_prec(RCP<Tpetra_CrsMatrix> A) {
+        if (prec.is_null() || !can_reuse(*A)) {
+            prec = build_ifpack2_prec(A);
+            matrix = A;
+            graph = A->getCrsGraph();
+            solves_since_compute = 0;
+        } else if (reuse == REUSE_SYMBOLIC ||
+                solves_since_compute >= recompute_interval) {
+            prec->compute();
+            solves_since_compute = 0;
+        }
+    }
+
+    int LinearSolver::solve_gmres(
+            RCP<Tpetra_CrsMatrix> A,
+            RCP<Tpetra_Vector> x,
+            RCP<Tpetra_Vector> b) {
+        const Teuchos::ParameterList &p = params->sublist("GMRES Solver");
+        const int max_iters = p.get<int>("Linear Max. Iterations");
+        update_prec(A);
+        RCP<Solver> solver = build_solver(Teuchos::rcpFromRef(p), prec, A, x, b);
+        solver->solve();
+        int iters = solver->getNumIters();
+        if (solves_since_compute > 0) {
+            // The factorization is lagged.
+            if (iters >= max_iters) {
+                prec->compute();
+                solves_since_compute = 0;
+                x->putScalar(0.0);
+                solver = build_solver(Teuchos::rcpFromRef(p), prec, A, x, b);
+                solver->solve();
+                iters = solver->getNumIters();
+            } else if (iters > recompute_growth * reference_iters) {
+                solves_since_compute = recompute_interval;
+            }
+        }
+        if (solves_since_compute == 0) reference_iters = iters;
+        ++solves_since_compute;
+        return iters;
+    }
+
+    void LinearSolver::solve_direct(
+            RCP<Tpetra_CrsMatrix> A,
+            RCP<Tpetra_Vector> x,
+            RCP<Tpetra_Vector> b) {
+        if (direct.is_null() || !can_reuse(*A)) {
+            direct = Amesos2::create<MAT, MV>("Superludist", A, x, b);
+            direct->symbolicFactorization();
+            matrix = A;
+            graph = A->getCrsGraph();
+        } else {
+            direct->setA(A, Amesos2::SYMBFACT);
+            direct->setX(x);
+            direct->setB(b);
+        }
+        direct->numericFactorization();
+        direct->solve();
+    }
+
+    void LinearSolver::solve(
             RCP<Tpetra_CrsMatrix> A,
             RCP<Tpetra_Vector> x,
             RCP<Tpetra_Vector> b) {
@@ -86,12 +167,9 @@ namespace CTM {
         double t0 = PCU_Time();
         double t1;
         // solve linear system
-        if (in->isSublist("GMRES Solver")) {
-            const Teuchos::ParameterList &p = in->sublist("GMRES Solver");
-            RCP<Prec> P = build_precond(in, A);
-            RCP<Solver> solver = build_solver(Teuchos::rcpFromRef(p), P, A, x, b);
-            solver->solve();
-            unsigned iters = solver->getNumIters();
+        if (params->isSublist("GMRES Solver")) {
+            const Teuchos::ParameterList &p = params->sublist("GMRES Solver");
+            unsigned iters = solve_gmres(A, x, b);
             t1 = PCU_Time();
             if (iters >= p.get<int>("Linear Max. Iterations")) {
                 *out << "  linear solve failed to converge in " << iters << " iterations" << std::endl;
@@ -101,12 +179,19 @@ namespace CTM {
                 *out << "  linear system solved in " << t1 - t0 << " seconds" << std::endl;
             }
         } else {
-            Teuchos::RCP<Amesos2::Solver<MAT, MV>> solver = Amesos2::create<MAT, MV>("Superludist", A, x, b);
-            solver->symbolicFactorization().numericFactorization();
-            solver->solve();
+            solve_direct(A, x, b);
             t1 = PCU_Time();
 
             *out << "  linear system solved in " << t1 - t0 << " seconds" << std::endl;
         }
     }
+
+    void solve_linear_system(
+            RCP<const ParameterList> in,
+            RCP<Tpetra_CrsMatrix> A,
+            RCP<Tpetra_Vector> x,
+            RCP<Tpetra_Vector> b) {
+        LinearSolver solver(in);
+        solver.solve(A, x, b);
+    }
 } // close namspace CTM
\ No newline at end of file
@@ -3,11 +3,80 @@
 
 #include "Albany_DataTypes.hpp"
 
+#include <Ifpack2_Preconditioner.hpp>
+#include <Amesos2_Solver.hpp>
+
 namespace CTM {
 
 using Teuchos::RCP;
 using Teuchos::ParameterList;
 
+/// \brief Solves the linear systems of a Newton loop.
+/// \details The preconditioner (GMRES) or the symbolic factorization
+/// (SuperLU_DIST) is kept across Newton iterations and time steps for as long
+/// as the Jacobian object and its graph are unchanged. The "Linear Algebra"
+/// list selects the policy:
+///
+/// Parameter Name                                 | Type   | Default
+/// --------------                                 | ----   | -------
+/// "Preconditioner Reuse"                         | string | "None"
+/// "Preconditioner Recompute Interval"            | int    | 5
+/// "Preconditioner Recompute Iteration Growth"    | double | 1.5
+///
+/// - "None": build a new preconditioner for every solve.
+/// - "Symbolic": keep the preconditioner object and its symbolic setup;
+///   recompute the numeric factorization for every solve.
+/// - "Lagged": also keep the numeric factorization, recomputing it after
+///   "Preconditioner Recompute Interval" solves, when the GMRES iteration
+///   count exceeds "Preconditioner Recompute Iteration Growth" times the count
+///   of the first solve after the last recompute, or when GMRES fails to
+///   converge (the solve is then repeated with the new factorization).
+///
+/// With SuperLU_DIST, any policy other than "None" keeps the symbolic
+/// factorization; the numeric factorization is always recomputed.
+class LinearSolver {
+public:
+    LinearSolver(RCP<const ParameterList> p);
+
+    void solve(
+        RCP<Tpetra_CrsMatrix> A,
+        RCP<Tpetra_Vector> x,
+        RCP<Tpetra_Vector> b);
+
+private:
+    typedef Ifpack2::Preconditioner<ST, LO, GO, KokkosNode> IfpackPrec;
+    typedef Amesos2::Solver<Tpetra_CrsMatrix, Tpetra_MultiVector> DirectSolver;
+
+    enum Reuse { REUSE_NONE, REUSE_SYMBOLIC, REUSE_LAGGED };
+
+    RCP<const ParameterList> params;
+    Reuse reuse;
+    int recompute_interval;
+    double recompute_growth;
+
+    // Matrix and graph the cached objects were built for, held so that a new
+    // matrix can't be mistaken for a freed one at the same address.
+    RCP<const Tpetra_CrsMatrix> matrix;
+    RCP<const Tpetra_CrsGraph> graph;
+    RCP<IfpackPrec> prec;
+    RCP<DirectSolver> direct;
+    // Solves since the last numeric factorization and the GMRES iteration
+    // count of the first of them.
+    int solves_since_compute;
+    int reference_iters;
+
+    bool can_reuse(const Tpetra_CrsMatrix& A);
+    void update_prec(RCP<Tpetra_CrsMatrix> A);
+    int solve_gmres(
+        RCP<Tpetra_CrsMatrix> A,
+        RCP<Tpetra_Vector> x,
+        RCP<Tpetra_Vector> b);
+    void solve_direct(
+        RCP<Tpetra_CrsMatrix> A,
+        RCP<Tpetra_Vector> x,
+        RCP<Tpetra_Vector> b);
+};
+
 void solve_linear_system(
     RCP<const ParameterList> p,
     RCP<Tpetra_CrsMatrix> A,
@@ -16,4 +85,4 @@ void solve_linear_system(
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -22,6 +22,7 @@
 #include "Sacado_ParameterAccessor.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
+#include "PHAL_NodeSetFunctionCache.hpp"
 #include <vector>
 
 
@@ -45,8 +46,20 @@ public:
   typedef typename EvalT::ScalarT ScalarT;
   KfieldBC_Base(Teuchos::ParameterList& p);
   ScalarT& getValue(const std::string &n);
-  void computeBCs(double* coord, ScalarT& Xval, ScalarT& Yval,
-                          RealType time);
+
+  // The displacements are KIfactor(t) times the mode I field plus
+  // KIIfactor(t) times the mode II field, both fixed functions of the
+  // coordinates. prepareBCs() sets the factors for the time and returns
+  // the fields on the nodes of the node set, four per node
+  // (KI_X, KI_Y, KII_X, KII_Y), cached until the X and Y coordinates
+  // of the node set change.
+  const double* prepareBCs(const std::vector<double*>& nsNodeCoords,
+                           RealType time);
+  void computeBCs(const double* fields, ScalarT& Xval, ScalarT& Yval) const
+  {
+    Xval = KIfactor * fields[0] + KIIfactor * fields[2];
+    Yval = KIfactor * fields[1] + KIIfactor * fields[3];
+  }
 
   RealType mu, nu, KIval, KIIval;
   ScalarT KI, KII;
@@ -57,6 +70,9 @@ protected:
   std::vector< RealType > timeValues;
   std::vector< RealType > KIValues;
   std::vector< RealType > KIIValues;
+
+  ScalarT KIfactor, KIIfactor;
+  PHAL::NodeSetFunctionCache modeFields;
 };
 
 // **************************************************************
@@ -22,7 +22,8 @@ KfieldBC_Base(Teuchos::ParameterList& p) :
 offset(p.get<int>("Equation Offset")),
   PHAL::DirichletBase<EvalT, Traits>(p),
   mu(p.get<RealType>("Shear Modulus")),
-  nu(p.get<RealType>("Poissons Ratio"))
+  nu(p.get<RealType>("Poissons Ratio")),
+  modeFields(2, 4)
 {
   KIval  = p.get<RealType>("KI Value");
   KIIval = p.get<RealType>("KII Value");
@@ -73,25 +74,15 @@ getValue(const std::string &n)
 
 // **********************************************************************
 template<typename EvalT, typename Traits>
-void
+const double*
 KfieldBC_Base<EvalT, Traits>::
-computeBCs(double* coord, ScalarT& Xval, ScalarT& Yval, RealType time)
+prepareBCs(const std::vector<double*>& nsNodeCoords, RealType time)
 {
 
   TEUCHOS_TEST_FOR_EXCEPTION( time > timeValues.back(),
                                       Teuchos::Exceptions::InvalidParameter,
                                       "Time is growing unbounded!" );
 
-  RealType X, Y, R, theta;
-  ScalarT coeff_1, coeff_2;
-  RealType tau = 6.283185307179586;
-  ScalarT KI_X, KI_Y, KII_X, KII_Y;
-
-  X = coord[0];
-  Y = coord[1];
-  R = std::sqrt(X*X + Y*Y);
-  theta = std::atan2(Y,X);
-
   ScalarT KIFunctionVal, KIIFunctionVal;
   RealType KIslope, KIIslope;
   unsigned int Index(0);
@@ -112,38 +103,26 @@ computeBCs(double* coord, ScalarT& Xval, ScalarT& Yval, RealType time)
     KIIFunctionVal = KIIValues[Index-1] + KIIslope * ( time - timeValues[Index - 1] );
   }
 
-  coeff_1 = ( KI*KIFunctionVal / mu ) * std::sqrt( R / tau );
-  coeff_2 = ( KII*KIIFunctionVal / mu ) * std::sqrt( R / tau );
-
-  KI_X  = coeff_1 * ( 1.0 - 2.0 * nu + std::sin( theta / 2.0 ) * std::sin( theta / 2.0 ) ) * std::cos( theta / 2.0 );
-  KI_Y  = coeff_1 * ( 2.0 - 2.0 * nu - std::cos( theta / 2.0 ) * std::cos( theta / 2.0 ) ) * std::sin( theta / 2.0 );
-
-  KII_X = coeff_2 * ( 2.0 - 2.0 * nu + std::cos( theta / 2.0 ) * std::cos( theta / 2.0 ) ) * std::sin( theta / 2.0 );
-  KII_Y = coeff_2 * (-1.0 + 2.0 * nu + std::sin( theta / 2.0 ) * std::sin( theta / 2.0 ) ) * std::cos( theta / 2.0 );
-
-  Xval = KI_X + KII_X;
-  Yval = KI_Y + KII_Y;
-
-/*
-//  JTO: I am going to leave this here for now...
-     std::cout << "================" << std::endl;
-     std::cout.precision(15);
-     std::cout << "X : " << X << ", Y: " << Y << ", R: " << R << std::endl;
-//     std::cout << "Node : " << nsNodes[inode] << std::endl;
-     std::cout << "KI : " << KI << ", KII: " << KII << std::endl;
-     std::cout << "theta: " << theta << std::endl;
-     std::cout << "coeff_1: " << coeff_1 << ", coeff_2: " << coeff_2 << std::endl;
-     std::cout << "KI_X: " << KI_X << ", KI_Y: " << KI_Y << std::endl;
-     std::cout << "Xval: " << Xval << ", Yval: " << Yval << std::endl;
-     std::cout << "nu: " << nu << std::endl;
-//     std::cout << "dx: " << (*x)[xlunk] << std::endl;
-//     std::cout << "dy: " << (*x)[ylunk] << std::endl;
-//     std::cout << "fx: " << ((*x)[xlunk] - Xval) << std::endl;
-//     std::cout << "fy: " << ((*x)[ylunk] - Yval) << std::endl;
-     std::cout << "sin(theta/2): " << std::sin( theta / 2.0 ) << std::endl;
-     std::cout << "cos(theta/2): " << std::cos( theta / 2.0 ) << std::endl;
-
-     */
+  KIfactor  = KI*KIFunctionVal / mu;
+  KIIfactor = KII*KIIFunctionVal / mu;
+
+  const RealType nu_ = nu;
+  return modeFields.values(nsNodeCoords,
+    [nu_](const double* coord, double* fields) {
+      const RealType tau = 6.283185307179586;
+      const RealType X = coord[0];
+      const RealType Y = coord[1];
+      const RealType R = std::sqrt(X*X + Y*Y);
+      const RealType theta = std::atan2(Y,X);
+      const RealType r = std::sqrt( R / tau );
+      const RealType s = std::sin( theta / 2.0 );
+      const RealType c = std::cos( theta / 2.0 );
+
+      fields[0] = r * ( 1.0 - 2.0 * nu_ + s * s ) * c;  // KI_X
+      fields[1] = r * ( 2.0 - 2.0 * nu_ - c * c ) * s;  // KI_Y
+      fields[2] = r * ( 2.0 - 2.0 * nu_ + c * c ) * s;  // KII_X
+      fields[3] = r * (-1.0 + 2.0 * nu_ + s * s ) * c;  // KII_Y
+    });
 }
 
 // **********************************************************************
@@ -178,15 +157,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   RealType time = dirichletWorkset.current_time;
 
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
 
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
 
     //(*f)[xlunk] = ((*x)[xlunk] - Xval);
@@ -235,7 +213,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
   int xlunk, ylunk; // local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
 
   ScalarT Xval, Yval; 
   Teuchos::Array<LO> index(1);
@@ -250,9 +228,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
     
     // replace jac values for the X dof 
     numEntriesT = jacT->getNumEntriesInLocalRow(xlunk);
@@ -320,15 +297,14 @@ RealType time = dirichletWorkset.current_time;
     dirichletWorkset.nodeSetCoords->find(this->nodeSetID)->second;
 
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     if (fT != Teuchos::null)
     {
@@ -466,16 +442,15 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 
   RealType time = dirichletWorkset.current_time;
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
 
   int nblock = x->size();
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     for (int block=0; block<nblock; block++) {
       (*f)[block][xlunk] = ((*x)[block][xlunk] - Xval.coeff(block));
@@ -524,15 +499,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   RealType time = dirichletWorkset.current_time;
 
   int xlunk, ylunk; // local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     // replace jac values for the X dof
     for (int block=0; block<nblock_jac; block++) {
@@ -591,15 +565,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 
   RealType time = dirichletWorkset.current_time;
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     if (f != Teuchos::null)
     {
@@ -661,16 +634,15 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 
   RealType time = dirichletWorkset.current_time;
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
 
   int nblock = x->size();
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     for (int block=0; block<nblock; block++) {
       (*f)[block][xlunk] = ((*x)[block][xlunk] - Xval.coeff(block));
@@ -719,15 +691,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   RealType time = dirichletWorkset.current_time;
 
   int xlunk, ylunk; // local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     // replace jac values for the X dof
     for (int block=0; block<nblock_jac; block++) {
@@ -786,15 +757,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   RealType time = dirichletWorkset.current_time;
 
   int xlunk, ylunk; // global and local indicies into unknown vector
-  double* coord;
+  const double* fields = this->prepareBCs(nsNodeCoords, time);
   ScalarT Xval, Yval;
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
   {
     xlunk = nsNodes[inode][0];
     ylunk = nsNodes[inode][1];
-    coord = nsNodeCoords[inode];
 
-    this->computeBCs(coord, Xval, Yval, time);
+    this->computeBCs(&fields[4*inode], Xval, Yval);
 
     if (f != Teuchos::null)
     {
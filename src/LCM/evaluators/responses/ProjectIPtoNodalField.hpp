@@ -35,6 +35,11 @@ namespace LCM {
  * reports x to STK's nodal database.
  *   The graph describing the mass matrix's structure is created in Albany::
  * STKDiscretization::meshToGraph().
+ *   If "Reuse Mass Matrix" is true, M and its preconditioned solver are kept
+ * until the nodal graph changes, i.e., until the mesh is adapted, and only b
+ * is assembled at the other projections. The option is off by default: it is
+ * wrong for moving meshes and reference configuration updates, which change
+ * the element volumes but not the graph.
  */
 
 template<typename EvalT, typename Traits>
@@ -42,7 +42,20 @@ public:
   // using.
   int ndb_start, ndb_numvecs;
 
-  ProjectIPtoNodalFieldManager () : nwrkr_(0), prectr_(0), postctr_(0) {}
+  // The mass matrix depends only on the mesh. With reuse_mass_matrix, once
+  // assembled and exported, it is kept together with its solver and the data
+  // transfer objects for as long as the nodal graph it was assembled on is
+  // current. Then only the right-hand side is assembled at each projection.
+  // Changes of the coordinates alone are not detected.
+  bool reuse_mass_matrix, fill_mass_matrix;
+  Teuchos::RCP<const Tpetra_CrsGraph> mass_graph;
+  Teuchos::RCP<Tpetra_Export> exporter;
+  Teuchos::RCP<Tpetra_Import> importer;
+  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>> solver;
+
+  ProjectIPtoNodalFieldManager ()
+    : reuse_mass_matrix(false), fill_mass_matrix(true),
+      nwrkr_(0), prectr_(0), postctr_(0) {}
 
   void registerWorker () { ++nwrkr_; }
   int nWorker () const { return nwrkr_; }
@@ -190,6 +203,10 @@ Teuchos::RCP<Teuchos::ParameterList> getValidProjectIPtoNodalFieldParameters ()
                       "Whether nodal field info should be output to a file");
   valid_pl->set<std::string>("Mass Matrix Type", "Full", "Full or Lumped");
   valid_pl->set<double>("Solver Tolerance", 1e-12, "Linear solver tolerance");
+  valid_pl->set<bool>("Reuse Mass Matrix", false,
+                      "Keep the mass matrix and its solver until the nodal graph changes. "
+                      "Only valid if the element volumes do not change otherwise, e.g., "
+                      "no mesh motion or reference configuration update");
 
   return valid_pl;
 }
@@ -366,6 +383,7 @@ initManager (Teuchos::ParameterList* const pl, const std::string& key_suffix) {
     mgr_ = Teuchos::rcp(new ProjectIPtoNodalFieldManager());
     mgr_->mass_matrix = Teuchos::rcp(
       ProjectIPtoNodalFieldManager::MassMatrix::create(mass_matrix_type));
+    mgr_->reuse_mass_matrix = pl->get<bool>("Reuse Mass Matrix", false);
     // Find out our starting position in the nodal database.
     mgr_->ndb_start = p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->
       getVecsize();
@@ -555,6 +573,18 @@ preEvaluate (typename Traits::PreEvalData workset) {
   // and nonoverlapping maps and so must be reallocated.
   Teuchos::RCP<const Tpetra_CrsGraph> current_graph = p_state_mgr_->
     getStateInfoStruct()->getNodalDataBase()->getNodalGraph();
+  mgr_->fill_mass_matrix = ! (mgr_->reuse_mass_matrix &&
+                              Teuchos::nonnull(current_graph) &&
+                              current_graph == mgr_->mass_graph);
+  if ( ! mgr_->fill_mass_matrix) {
+    // The mesh did not change: keep the exported mass matrix and its solver.
+    mgr_->ip_field = Teuchos::rcp(
+      new Tpetra_MultiVector(current_graph->getRowMap(), mgr_->ndb_numvecs,
+                             true));
+    return;
+  }
+  mgr_->mass_graph = Teuchos::null;
+  mgr_->solver = Teuchos::null;
   if (Teuchos::nonnull(current_graph)) {
     // Use a graph if it's available.
     mgr_->mass_matrix->matrix() =
@@ -582,6 +612,7 @@ fillRHS (const typename Traits::EvalData workset) {
     getNodalDataVector();
   const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>&
     wsElNodeID = workset.wsElNodeID;
+  const Teuchos::RCP<const Tpetra_Map> row_map = mgr_->ip_field->getMap();
 
   const int num_fields = num_fields_
 #ifdef PROJ_INTERP_TEST
@@ -593,33 +624,36 @@ fillRHS (const typename Traits::EvalData workset) {
     node_data->getNDofsAndOffset(nodal_field_names_[field], node_var_offset,
                                  node_var_ndofs);
     node_var_offset -= mgr_->ndb_start;
+    // Integrate over the cell first, then add each component once per node.
+    const int ncomp = (ip_field_layouts_[field] == EFieldLayout::scalar ? 1 :
+                       ip_field_layouts_[field] == EFieldLayout::vector ?
+                       num_dims_ : num_dims_*num_dims_);
+    ST val[9];
     for (unsigned int cell = 0; cell < workset.numCells; ++cell) {
       for (std::size_t node = 0; node < num_nodes_; ++node) {
-        const GO global_row = wsElNodeID[cell][node];
+        const LO local_row = row_map->getLocalElement(wsElNodeID[cell][node]);
+        for (int k = 0; k < ncomp; ++k) val[k] = 0;
         for (std::size_t qp = 0; qp < num_pts_; ++qp) {
+          const MeshScalarT w = wBF(cell, node, qp);
           switch (ip_field_layouts_[field]) {
           case EFieldLayout::scalar:
-            mgr_->ip_field->sumIntoGlobalValue(
-              global_row, node_var_offset,
-              ip_fields_[field](cell, qp) * wBF(cell, node, qp));
+            val[0] += ip_fields_[field](cell, qp) * w;
             break;
           case EFieldLayout::vector:
             for (std::size_t dim0 = 0; dim0 < num_dims_; ++dim0)
-              mgr_->ip_field->sumIntoGlobalValue(
-                global_row, node_var_offset + dim0,
-                (ip_fields_[field](cell, qp, dim0) *
-                 wBF(cell, node, qp)));
+              val[dim0] += ip_fields_[field](cell, qp, dim0) * w;
             break;
           case EFieldLayout::tensor:
             for (std::size_t dim0 = 0; dim0 < num_dims_; ++dim0)
               for (std::size_t dim1 = 0; dim1 < num_dims_; ++dim1)
-                mgr_->ip_field->sumIntoGlobalValue(
-                  global_row, node_var_offset + dim0*num_dims_ + dim1,
-                  (ip_fields_[field](cell, qp, dim0, dim1) *
-                   wBF(cell, node, qp)));
+                val[dim0*num_dims_ + dim1] +=
+                  ip_fields_[field](cell, qp, dim0, dim1) * w;
             break;
           }
         }
+        for (int k = 0; k < ncomp; ++k)
+          mgr_->ip_field->sumIntoLocalValue(local_row, node_var_offset + k,
+                                            val[k]);
       }
     } // cell
   } // field
@@ -636,11 +670,13 @@ static double test_fn (const double x, const double y, const double z) {
 template<typename Traits>
 void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields (typename Traits::EvalData workset) {
-  if (Teuchos::nonnull(quad_mgr_)) {
-    quad_mgr_->evaluateBasis(coords_verts_);
-    mgr_->mass_matrix->fill(workset, quad_mgr_->bf(), quad_mgr_->wbf());
-  } else
-    mgr_->mass_matrix->fill(workset, BF, wBF);
+  if (mgr_->fill_mass_matrix) {
+    if (Teuchos::nonnull(quad_mgr_)) {
+      quad_mgr_->evaluateBasis(coords_verts_);
+      mgr_->mass_matrix->fill(workset, quad_mgr_->bf(), quad_mgr_->wbf());
+    } else
+      mgr_->mass_matrix->fill(workset, BF, wBF);
+  }
 #ifdef PROJ_INTERP_TEST
   PHX::MDField<RealType>& f = ip_fields_.back();
   for (unsigned int cell = 0; cell < workset.numCells; ++cell)
@@ -666,21 +702,22 @@ postEvaluate (typename Traits::PostEvalData workset) {
   Teuchos::RCP<Teuchos::FancyOStream>
     out = Teuchos::VerboseObjectBase::getDefaultOStream();
 
-  mgr_->mass_matrix->matrix()->fillComplete();
-
-  // Right now, ip_field and mass_matrix->matrix() have the same overlapping
-  // (row) map.
-  //   1. If we're not using a preconditioner, then we could fillComplete the
-  // mass matrix with valid 1-1 domain and range maps, export ip_field to b,
-  // where b has the mass matrix's range map, and proceed. The linear algebra
-  // using the matrix would be limited to matrix-vector products, which would
-  // use these valid range and domain maps.
-  //   2. However, we want to use Ifpack2, and Ifpack2 assumes the row map is
-  // nonoverlapping. (This assumption makes sense because of the type of
-  // operations Ifpack2 performs.) Hence I export mass matrix to a new matrix
-  // having nonoverlapping row and col maps. As in case 1, I also have to create
-  // a compatible b.
-  {
+  if (mgr_->fill_mass_matrix) {
+    mgr_->mass_matrix->matrix()->fillComplete();
+
+    // Right now, ip_field and mass_matrix->matrix() have the same overlapping
+    // (row) map.
+    //   1. If we're not using a preconditioner, then we could fillComplete the
+    // mass matrix with valid 1-1 domain and range maps, export ip_field to b,
+    // where b has the mass matrix's range map, and proceed. The linear algebra
+    // using the matrix would be limited to matrix-vector products, which would
+    // use these valid range and domain maps.
+    //   2. However, we want to use Ifpack2, and Ifpack2 assumes the row map is
+    // nonoverlapping. (This assumption makes sense because of the type of
+    // operations Ifpack2 performs.) Hence I export mass matrix to a new matrix
+    // having nonoverlapping row and col maps. As in case 1, I also have to
+    // create a compatible b.
+
     // Get overlapping and nonoverlapping maps.
     const Teuchos::RCP<const Tpetra_CrsMatrix>&
       mm_ovl = mgr_->mass_matrix->matrix();
@@ -690,35 +727,45 @@ postEvaluate (typename Traits::PostEvalData workset) {
       p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->
         updateNodalGraph(mm_ovl->getCrsGraph());
     }
+    mgr_->mass_graph = mm_ovl->getCrsGraph();
     const Teuchos::RCP<const Tpetra_Map> ovl_map = mm_ovl->getRowMap();
     const Teuchos::RCP<const Tpetra_Map> map = Tpetra::createOneToOne(ovl_map);
     // Export the mass matrix.
-    Teuchos::RCP<Tpetra_Export>
-      e = Teuchos::rcp(new Tpetra_Export(ovl_map, map));
+    mgr_->exporter = Teuchos::rcp(new Tpetra_Export(ovl_map, map));
     Teuchos::RCP<Tpetra_CrsMatrix>
       mm = rcp(new Tpetra_CrsMatrix(map, mm_ovl->getGlobalMaxNumRowEntries()));
-    mm->doExport(*mm_ovl, *e, Tpetra::ADD);
+    mm->doExport(*mm_ovl, *mgr_->exporter, Tpetra::ADD);
     mm->fillComplete();
     // We don't need the assemble form of the mass matrix any longer.
     mgr_->mass_matrix->matrix() = mm;
-    // Now export ip_field.
+
+    // Set up the solver; it is kept with the mass matrix.
+    const Teuchos::RCP<Tpetra_Operator> tpetra_A = mm;
+    const Teuchos::RCP<const Thyra::LinearOpBase<ST>>
+      A = Thyra::createLinearOp(tpetra_A);
+    mgr_->solver = lowsFactory_->createOp();
+    Thyra::initializeOp<ST>(*lowsFactory_, A, mgr_->solver.ptr());
+
+    const Teuchos::RCP<const Tpetra_Map>
+      ndb_ovl_map = (p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->
+                     getNodalDataVector()->getOverlapMap());
+    mgr_->importer = Teuchos::rcp(new Tpetra_Import(mm->getDomainMap(),
+                                                    ndb_ovl_map));
+  }
+  const Teuchos::RCP<Tpetra_CrsMatrix>& mm = mgr_->mass_matrix->matrix();
+  { // Now export ip_field.
     Teuchos::RCP<Tpetra_MultiVector> ipf = rcp(
       new Tpetra_MultiVector(mm->getRangeMap(),
                              mgr_->ip_field->getNumVectors()));
-    ipf->doExport(*mgr_->ip_field, *e, Tpetra::ADD);
+    ipf->doExport(*mgr_->ip_field, *mgr_->exporter, Tpetra::ADD);
     // Don't need the assemble form of the ip_field either.
     mgr_->ip_field = ipf;
   }
   // Create x in A x = b.
   Teuchos::RCP<Tpetra_MultiVector> node_projected_ip_field = rcp(
-    new Tpetra_MultiVector(mgr_->mass_matrix->matrix()->getDomainMap(),
+    new Tpetra_MultiVector(mm->getDomainMap(),
                            mgr_->ip_field->getNumVectors()));
-  const Teuchos::RCP<Tpetra_Operator> tpetra_A = mgr_->mass_matrix->matrix();
-  const Teuchos::RCP<Thyra::LinearOpBase<ST>>
-    A = Thyra::createLinearOp(tpetra_A);
-  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>>
-    nsA = lowsFactory_->createOp();
-  Thyra::initializeOp<ST>(*lowsFactory_, A, nsA.ptr());
+  const Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>>& nsA = mgr_->solver;
   Teuchos::RCP< Thyra::MultiVectorBase<ST>>
     x = Thyra::createMultiVector<ST, LO, GO, KokkosNode>(node_projected_ip_field),
     b = Thyra::createMultiVector<ST, LO, GO, KokkosNode>(mgr_->ip_field);
@@ -745,7 +792,7 @@ postEvaluate (typename Traits::PostEvalData workset) {
     y = Thyra::createMembers(x->range(), x->domain());
 
   // Compute y = A*x, where x is the solution from the linear solver.
-  A->apply(Thyra::NOTRANS, *x, y.ptr(), 1.0, 0.0);
+  nsA->apply(Thyra::NOTRANS, *x, y.ptr(), 1.0, 0.0);
 
   // Compute A*x - b = y - b.
   Thyra::update(-one, *b, y.ptr());
@@ -760,16 +807,10 @@ postEvaluate (typename Traits::PostEvalData workset) {
   }
 #endif
   { // Store the overlapped vector data back in stk.
-    const Teuchos::RCP<const Tpetra_Map>
-      ovl_map = (p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->
-                 getNodalDataVector()->getOverlapMap()),
-      map = node_projected_ip_field->getMap();
     Teuchos::RCP<Tpetra_MultiVector> npif = rcp(
-      new Tpetra_MultiVector(ovl_map,
+      new Tpetra_MultiVector(mgr_->importer->getTargetMap(),
                              node_projected_ip_field->getNumVectors()));
-    Teuchos::RCP<Tpetra_Import>
-      im = Teuchos::rcp(new Tpetra_Import(map, ovl_map));
-    npif->doImport(*node_projected_ip_field, *im, Tpetra::ADD);
+    npif->doImport(*node_projected_ip_field, *mgr_->importer, Tpetra::ADD);
     p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->
       getNodalDataVector()->saveNodalDataState(npif, mgr_->ndb_start);
   }
@@ -3,6 +3,7 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include <algorithm>
 #include <Teuchos_UnitTestHarness.hpp>
 #include <LocalNonlinearSolver.hpp>
 #include <Sacado.hpp>
@@ -171,4 +172,52 @@ TEUCHOS_UNIT_TEST( LocalNonlinearSolver, Tangent )
     { std::sqrt(2) };
   TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
 }
+
+TEUCHOS_UNIT_TEST( LocalNonlinearSolver, FixedSizeMatchesLapack )
+{
+  typedef PHAL::AlbanyTraits Traits;
+  typedef PHAL::AlbanyTraits::Jacobian EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // a system small enough for the fixed-size kernels, with a pivot
+  const int n = 3;
+  const int numGlobalVars = 2;
+  const RealType A[] =
+    { 0.1, 4.0, 1.0, 2.0, 1.0, 0.5, 1.0, 0.3, 3.0 };
+  const RealType F[] =
+    { 1.0, 2.0, 3.0 };
+  const RealType dFdP[] =
+    { 0.5, -1.0, 2.0, 1.5, 0.25, -0.75 };
+
+  std::vector<ScalarT> dFdX(n * n), X(n), B(n);
+  for (int i(0); i < n * n; ++i)
+    dFdX[i] = A[i];
+  for (int i(0); i < n; ++i) {
+    X[i] = 0.0;
+    B[i] = ScalarT(numGlobalVars, F[i]);
+    for (int j(0); j < numGlobalVars; ++j)
+      B[i].fastAccessDx(j) = dFdP[i + n * j];
+  }
+
+  LCM::LocalNonlinearSolver<EvalT, Traits> solver;
+  solver.solve(dFdX, X, B);
+  solver.computeFadInfo(dFdX, X, B);
+
+  // reference: LAPACK on the values, with the derivative columns as
+  // additional right-hand sides
+  std::vector<RealType> LU(A, A + n * n);
+  std::vector<RealType> rhs(n * (1 + numGlobalVars));
+  std::copy(F, F + n, rhs.begin());
+  std::copy(dFdP, dFdP + n * numGlobalVars, rhs.begin() + n);
+  std::vector<int> IPIV(n);
+  int info(0);
+  solver.lapack.GESV(n, 1 + numGlobalVars, &LU[0], n, &IPIV[0], &rhs[0], n,
+      &info);
+
+  for (int i(0); i < n; ++i) {
+    TEST_COMPARE(fabs(X[i].val() + rhs[i]), <=, 1.0e-14);
+    for (int j(0); j < numGlobalVars; ++j)
+      TEST_COMPARE(fabs(X[i].dx(j) + rhs[i + n * (1 + j)]), <=, 1.0e-14);
+  }
+}
 } // namespace
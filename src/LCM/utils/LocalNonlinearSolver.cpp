@@ -9,3 +9,41 @@
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::LocalNonlinearSolver_Base)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::LocalNonlinearSolver)
 
+
+namespace LCM
+{
+
+namespace local_solver
+{
+
+void
+solve(
+    Teuchos::LAPACK<int, RealType> & lapack,
+    std::vector<RealType> & A,
+    std::vector<RealType> & B)
+{
+  // system size
+  int numLocalVars = B.size();
+
+  if (numLocalVars <= MAX_FIXED_SIZE) {
+    RealType LU[MAX_FIXED_SIZE * MAX_FIXED_SIZE];
+    int IPIV[MAX_FIXED_SIZE];
+    std::copy(A.begin(), A.begin() + numLocalVars * numLocalVars, LU);
+    if (Fixed<MAX_FIXED_SIZE>::factor(numLocalVars, LU, IPIV)) {
+      Fixed<MAX_FIXED_SIZE>::substitute(numLocalVars, LU, IPIV, &B[0]);
+      return;
+    }
+  }
+
+  // data for the LAPACK call below
+  int info(0);
+  std::vector<int> IPIV(numLocalVars);
+
+  // call LAPACK
+  lapack.GESV(numLocalVars, 1, &A[0], numLocalVars, &IPIV[0], &B[0],
+      numLocalVars, &info);
+}
+
+} // namespace local_solver
+
+} // namespace LCM
@@ -14,6 +14,103 @@
 namespace LCM
 {
 
+namespace local_solver
+{
+
+///
+/// Largest local system solved with the fixed-size kernels below; larger
+/// systems are solved with LAPACK.
+///
+static constexpr int
+MAX_FIXED_SIZE = 12;
+
+///
+/// In-place LU factorization with partial pivoting of the column-major
+/// N x N matrix A, with the same conventions as LAPACK GETRF (0-based
+/// pivots). The size is a compile-time constant so that the loops are
+/// unrolled and nothing is allocated. Returns false if A is singular.
+///
+template<int N>
+bool
+factor(RealType * A, int * piv);
+
+///
+/// Solve with the factors computed by factor<N>, overwriting b.
+///
+template<int N>
+void
+substitute(RealType const * LU, int const * piv, RealType * b);
+
+///
+/// Dispatch a run-time size n <= N to the fixed-size kernels.
+///
+template<int N>
+struct Fixed
+{
+  static bool
+  factor(int const n, RealType * A, int * piv)
+  {
+    return n == N ? local_solver::factor<N>(A, piv) :
+        Fixed<N - 1>::factor(n, A, piv);
+  }
+
+  static void
+  substitute(int const n, RealType const * LU, int const * piv, RealType * b)
+  {
+    if (n == N) local_solver::substitute<N>(LU, piv, b);
+    else Fixed<N - 1>::substitute(n, LU, piv, b);
+  }
+};
+
+template<>
+struct Fixed<0>
+{
+  static bool
+  factor(int const, RealType *, int *)
+  {
+    return false;
+  }
+
+  static void
+  substitute(int const, RealType const *, int const *, RealType *)
+  {
+  }
+};
+
+///
+/// Solve A X = B in place for one right-hand side (as GESV with nrhs = 1).
+///
+void
+solve(
+    Teuchos::LAPACK<int, RealType> & lapack,
+    std::vector<RealType> & A,
+    std::vector<RealType> & B);
+
+///
+/// Newton update X -= A^{-1} B using the values of the Sacado types.
+///
+template<typename ScalarT>
+void
+newtonStep(
+    Teuchos::LAPACK<int, RealType> & lapack,
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B);
+
+///
+/// Implicit function theorem: dX/dp = -A^{-1} dB/dp, stored as the
+/// derivative components of X.
+///
+template<typename ScalarT>
+void
+implicitDerivatives(
+    Teuchos::LAPACK<int, RealType> & lapack,
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B);
+
+} // namespace local_solver
+
 ///
 /// Local Nonlinear Solver Base class
 ///
@@ -4,77 +4,65 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
-namespace LCM
-{
+#include <algorithm>
+#include <cmath>
 
-template<typename EvalT, typename Traits>
-LocalNonlinearSolver_Base<EvalT, Traits>::LocalNonlinearSolver_Base() :
-    lapack()
+namespace LCM
 {
-}
 
-// -----------------------------------------------------------------------------
-// Specializations
-// -----------------------------------------------------------------------------
-
-// -----------------------------------------------------------------------------
-// Residual
-// -----------------------------------------------------------------------------
-template<typename Traits>
-LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::LocalNonlinearSolver() :
-    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Residual, Traits>()
+namespace local_solver
 {
-}
 
-template<typename Traits>
-void
-inline
-LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::
-solve(
-    std::vector<ScalarT> & A,
-    std::vector<ScalarT> & X,
-    std::vector<ScalarT> & B)
+template<int N>
+bool
+factor(RealType * A, int * piv)
 {
-  // system size
-  int numLocalVars = B.size();
-
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &A[0], numLocalVars, &IPIV[0], &B[0],
-      numLocalVars, &info);
-
-  // increment the solution
-  for (int i(0); i < numLocalVars; ++i)
-    X[i] -= B[i];
+  for (int k(0); k < N; ++k) {
+    int p = k;
+    RealType max = std::abs(A[k + N * k]);
+    for (int i(k + 1); i < N; ++i) {
+      RealType const v = std::abs(A[i + N * k]);
+      if (v > max) {
+        max = v;
+        p = i;
+      }
+    }
+    piv[k] = p;
+    if (max == 0.0) return false;
+    if (p != k) {
+      for (int j(0); j < N; ++j)
+        std::swap(A[k + N * j], A[p + N * j]);
+    }
+    RealType const inv = 1.0 / A[k + N * k];
+    for (int i(k + 1); i < N; ++i) {
+      RealType const l = A[i + N * k] *= inv;
+      for (int j(k + 1); j < N; ++j)
+        A[i + N * j] -= l * A[k + N * j];
+    }
+  }
+  return true;
 }
 
-template<typename Traits>
+template<int N>
 void
-LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::
-computeFadInfo(
-    std::vector<ScalarT> & A,
-    std::vector<ScalarT> & X,
-    std::vector<ScalarT> & B)
-{
-  // no-op
-}
-
-// -----------------------------------------------------------------------------
-// Jacobian
-// -----------------------------------------------------------------------------
-template<typename Traits>
-LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::LocalNonlinearSolver() :
-    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Jacobian, Traits>()
+substitute(RealType const * LU, int const * piv, RealType * b)
 {
+  for (int k(0); k < N; ++k)
+    if (piv[k] != k) std::swap(b[k], b[piv[k]]);
+  for (int i(1); i < N; ++i)
+    for (int j(0); j < i; ++j)
+      b[i] -= LU[i + N * j] * b[j];
+  for (int i(N - 1); i >= 0; --i) {
+    for (int j(i + 1); j < N; ++j)
+      b[i] -= LU[i + N * j] * b[j];
+    b[i] /= LU[i + N * i];
+  }
 }
 
-template<typename Traits>
+template<typename ScalarT>
 void
-LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::
-solve(
+newtonStep(
+    Teuchos::LAPACK<int, RealType> & lapack,
     std::vector<ScalarT> & A,
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
@@ -82,6 +70,23 @@ solve(
   // system size
   int numLocalVars = B.size();
 
+  if (numLocalVars <= MAX_FIXED_SIZE) {
+    RealType F[MAX_FIXED_SIZE];
+    RealType dFdX[MAX_FIXED_SIZE * MAX_FIXED_SIZE];
+    int IPIV[MAX_FIXED_SIZE];
+    for (int i(0); i < numLocalVars; ++i) {
+      F[i] = B[i].val();
+      for (int j(0); j < numLocalVars; ++j)
+        dFdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
+    }
+    if (Fixed<MAX_FIXED_SIZE>::factor(numLocalVars, dFdX, IPIV)) {
+      Fixed<MAX_FIXED_SIZE>::substitute(numLocalVars, dFdX, IPIV, F);
+      for (int i(0); i < numLocalVars; ++i)
+        X[i].val() -= F[i];
+      return;
+    }
+  }
+
   // data for the LAPACK call below
   int info(0);
   std::vector<int> IPIV(numLocalVars);
@@ -99,19 +104,18 @@ solve(
   }
 
   // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
+  lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
       numLocalVars, &info);
 
   // increment the solution
   for (int i(0); i < numLocalVars; ++i)
     X[i].val() -= F[i];
-
 }
 
-template<typename Traits>
+template<typename ScalarT>
 void
-LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::
-computeFadInfo(
+implicitDerivatives(
+    Teuchos::LAPACK<int, RealType> & lapack,
     std::vector<ScalarT> & A,
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
@@ -119,8 +123,30 @@ computeFadInfo(
   // local system size
   int numLocalVars = B.size();
   int numGlobalVars = B[0].size();
-  TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
-      "In LocalNonlinearSolver<Jacobian> the numGLobalVars is zero where it should be positive\n");
+
+  if (numLocalVars <= MAX_FIXED_SIZE) {
+    // factor the jacobian once, then solve for one column of dXdP at a time
+    RealType dBdX[MAX_FIXED_SIZE * MAX_FIXED_SIZE];
+    RealType dBdP[MAX_FIXED_SIZE];
+    int IPIV[MAX_FIXED_SIZE];
+    for (int i(0); i < numLocalVars; ++i) {
+      for (int j(0); j < numLocalVars; ++j) {
+        dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
+      }
+    }
+    if (Fixed<MAX_FIXED_SIZE>::factor(numLocalVars, dBdX, IPIV)) {
+      for (int i(0); i < numLocalVars; ++i)
+        X[i].resize(numGlobalVars);
+      for (int j(0); j < numGlobalVars; ++j) {
+        for (int i(0); i < numLocalVars; ++i)
+          dBdP[i] = B[i].dx(j);
+        Fixed<MAX_FIXED_SIZE>::substitute(numLocalVars, dBdX, IPIV, dBdP);
+        for (int i(0); i < numLocalVars; ++i)
+          X[i].fastAccessDx(j) = -dBdP[i];
+      }
+      return;
+    }
+  }
 
   // data for the LAPACK call below
   int info(0);
@@ -141,8 +167,9 @@ computeFadInfo(
       dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
     }
   }
+
   // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
+  lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
       &IPIV[0], &dBdP[0], numLocalVars, &info);
 
   // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
@@ -156,98 +183,122 @@ computeFadInfo(
   }
 }
 
+} // namespace local_solver
+
+template<typename EvalT, typename Traits>
+LocalNonlinearSolver_Base<EvalT, Traits>::LocalNonlinearSolver_Base() :
+    lapack()
+{
+}
+
 // -----------------------------------------------------------------------------
-// Tangent
+// Specializations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Residual
 // -----------------------------------------------------------------------------
 template<typename Traits>
-LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::LocalNonlinearSolver() :
-    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Tangent, Traits>()
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::LocalNonlinearSolver() :
+    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Residual, Traits>()
 {
 }
 
 template<typename Traits>
 void
-LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::
+inline
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::
 solve(
     std::vector<ScalarT> & A,
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
 {
-  // system size
-  int numLocalVars = B.size();
+  local_solver::solve(this->lapack, A, B);
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
+  // increment the solution
+  for (int i(0); i < B.size(); ++i)
+    X[i] -= B[i];
+}
 
-  // fill B and dBdX
-  std::vector<RealType> F(numLocalVars);
-  std::vector<RealType> dFdX(numLocalVars * numLocalVars);
-  for (int i(0); i < numLocalVars; ++i)
-      {
-    F[i] = B[i].val();
-    for (int j(0); j < numLocalVars; ++j)
-        {
-      dFdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
-    }
-  }
+template<typename Traits>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::
+computeFadInfo(
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B)
+{
+  // no-op
+}
 
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
-      numLocalVars, &info);
+// -----------------------------------------------------------------------------
+// Jacobian
+// -----------------------------------------------------------------------------
+template<typename Traits>
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::LocalNonlinearSolver() :
+    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Jacobian, Traits>()
+{
+}
 
-  // increment the solution
-  for (int i(0); i < numLocalVars; ++i)
-    X[i].val() -= F[i];
+template<typename Traits>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::
+solve(
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B)
+{
+  local_solver::newtonStep(this->lapack, A, X, B);
 }
 
 template<typename Traits>
 void
-LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::
 computeFadInfo(
     std::vector<ScalarT> & A,
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
 {
-  // local system size
-  int numLocalVars = B.size();
   int numGlobalVars = B[0].size();
   TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
-      "In LocalNonlinearSolver<Tangent, Traits> the numGLobalVars is zero where it should be positive\n");
+      "In LocalNonlinearSolver<Jacobian> the numGLobalVars is zero where it should be positive\n");
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
+  local_solver::implicitDerivatives(this->lapack, A, X, B);
+}
 
-  // extract sensitivites of objective function(s) wrt p
-  std::vector<RealType> dBdP(numLocalVars * numGlobalVars);
-  for (int i(0); i < numLocalVars; ++i) {
-    for (int j(0); j < numGlobalVars; ++j) {
-      dBdP[i + numLocalVars * j] = B[i].dx(j);
-    }
-  }
+// -----------------------------------------------------------------------------
+// Tangent
+// -----------------------------------------------------------------------------
+template<typename Traits>
+LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::LocalNonlinearSolver() :
+    LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Tangent, Traits>()
+{
+}
 
-  // extract the jacobian
-  std::vector<RealType> dBdX(A.size());
-  for (int i(0); i < numLocalVars; ++i) {
-    for (int j(0); j < numLocalVars; ++j) {
-      dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
-    }
-  }
+template<typename Traits>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::
+solve(
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B)
+{
+  local_solver::newtonStep(this->lapack, A, X, B);
+}
 
-  // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
-      &IPIV[0], &dBdP[0], numLocalVars, &info);
+template<typename Traits>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::
+computeFadInfo(
+    std::vector<ScalarT> & A,
+    std::vector<ScalarT> & X,
+    std::vector<ScalarT> & B)
+{
+  int numGlobalVars = B[0].size();
+  TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
+      "In LocalNonlinearSolver<Tangent, Traits> the numGLobalVars is zero where it should be positive\n");
 
-  // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
-  for (int i(0); i < numLocalVars; ++i)
-      {
-    X[i].resize(numGlobalVars);
-    for (int j(0); j < numGlobalVars; ++j)
-        {
-      X[i].fastAccessDx(j) = -dBdP[i + numLocalVars * j];
-    }
-  }
+  local_solver::implicitDerivatives(this->lapack, A, X, B);
 }
 
 // -----------------------------------------------------------------------------
@@ -267,32 +318,7 @@ solve(
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
 {
-  // system size
-  int numLocalVars = B.size();
-
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
-  // fill B and dBdX
-  std::vector<RealType> F(numLocalVars);
-  std::vector<RealType> dFdX(numLocalVars * numLocalVars);
-  for (int i(0); i < numLocalVars; ++i)
-      {
-    F[i] = B[i].val();
-    for (int j(0); j < numLocalVars; ++j)
-        {
-      dFdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
-    }
-  }
-
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
-      numLocalVars, &info);
-
-  // increment the solution
-  for (int i(0); i < numLocalVars; ++i)
-    X[i].val() -= F[i];
+  local_solver::newtonStep(this->lapack, A, X, B);
 }
 
 template<typename Traits>
@@ -303,45 +329,11 @@ computeFadInfo(
     std::vector<ScalarT> & X,
     std::vector<ScalarT> & B)
 {
-  // local system size
-  int numLocalVars = B.size();
   int numGlobalVars = B[0].size();
   TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
       "In LocalNonlinearSolver<Tangent, Traits> the numGLobalVars is zero where it should be positive\n");
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
-  // extract sensitivites of objective function(s) wrt p
-  std::vector<RealType> dBdP(numLocalVars * numGlobalVars);
-  for (int i(0); i < numLocalVars; ++i) {
-    for (int j(0); j < numGlobalVars; ++j) {
-      dBdP[i + numLocalVars * j] = B[i].dx(j);
-    }
-  }
-
-  // extract the jacobian
-  std::vector<RealType> dBdX(A.size());
-  for (int i(0); i < numLocalVars; ++i) {
-    for (int j(0); j < numLocalVars; ++j) {
-      dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
-    }
-  }
-
-  // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
-      &IPIV[0], &dBdP[0], numLocalVars, &info);
-
-  // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
-  for (int i(0); i < numLocalVars; ++i)
-      {
-    X[i].resize(numGlobalVars);
-    for (int j(0); j < numGlobalVars; ++j)
-        {
-      X[i].fastAccessDx(j) = -dBdP[i + numLocalVars * j];
-    }
-  }
+  local_solver::implicitDerivatives(this->lapack, A, X, B);
 }
 
 // -----------------------------------------------------------------------------
@@ -38,7 +38,7 @@ void LCM::PeridigmManager::initializeSingleton(
   }
 }
 
-LCM::PeridigmManager::PeridigmManager() : hasPeridynamics(false), enableOptimizationBasedCoupling(false), obcScaleFactor(1.0), previousTime(0.0), currentTime(0.0), timeStep(0.0), cubatureDegree(-1)
+LCM::PeridigmManager::PeridigmManager() : hasPeridynamics(false), enableOptimizationBasedCoupling(false), obcScaleFactor(1.0), previousTime(0.0), currentTime(0.0), timeStep(0.0), cubatureDegree(-1), tangentCacheNumEntries(-1)
 {}
 
 void LCM::PeridigmManager::initialize(const Teuchos::RCP<Teuchos::ParameterList>& params,
@@ -1096,51 +1096,90 @@ void LCM::PeridigmManager::writePeridigmSubModel(RealType currentTime)
     peridigm->writePeridigmSubModel(currentTime);
 }
 
+void LCM::PeridigmManager::invalidateTangentCopyCache()
+{
+  tangentCacheAlbanyGraph = Teuchos::null;
+  tangentCachePeridigmMatrix = Teuchos::null;
+  tangentCacheNumEntries = -1;
+  tangentValuePositions.clear();
+}
+
+void LCM::PeridigmManager::buildTangentCopyCache(const Tpetra_CrsMatrix& jacT, const Teuchos::RCP<const Epetra_FECrsMatrix>& peridigmTangentRCP)
+{
+  const Epetra_FECrsMatrix& peridigmTangent = *peridigmTangentRCP;
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!jacT.isStaticGraph(), "\n\n**** Error in PeridigmManager::buildTangentCopyCache(), the Albany Jacobian must have a static graph.\n\n");
+
+  const Teuchos::RCP<const Tpetra_CrsGraph> albanyGraph = jacT.getCrsGraph();
+  const Tpetra_CrsGraph::local_graph_type albanyLocalGraph = albanyGraph->getLocalGraph();
+  const Teuchos::RCP<const Tpetra_Map> albanyRowMap = albanyGraph->getRowMap();
+  const Teuchos::RCP<const Tpetra_Map> albanyColMap = albanyGraph->getColMap();
+
+  tangentValuePositions.clear();
+  tangentValuePositions.reserve(peridigmTangent.NumMyNonzeros());
+
+  for(int peridigmLocalRow=0 ; peridigmLocalRow<peridigmTangent.NumMyRows() ; peridigmLocalRow++){
+
+    int globalRow = peridigmTangent.RowMatrixRowMap().GID(peridigmLocalRow);
+    LO albanyLocalRow = albanyRowMap->getLocalElement(globalRow);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(albanyLocalRow == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::buildTangentCopyCache(), invalid Albany local row.\n\n");
+
+    int peridigmNumEntries;
+    double* peridigmValues;
+    int* peridigmLocalColIndices;
+    peridigmTangent.ExtractMyRowView(peridigmLocalRow, peridigmNumEntries, peridigmValues, peridigmLocalColIndices);
+
+    const std::size_t rowBegin = albanyLocalGraph.row_map(albanyLocalRow);
+    const std::size_t rowEnd = albanyLocalGraph.row_map(albanyLocalRow+1);
+    for(int i=0 ; i<peridigmNumEntries ; i++){
+      int globalCol = peridigmTangent.ColMap().GID(peridigmLocalColIndices[i]);
+      LO albanyLocalCol = albanyColMap->getLocalElement(static_cast<GO>(globalCol));
+      std::size_t pos = rowEnd;
+      for(std::size_t k=rowBegin ; k<rowEnd ; k++){
+        if(albanyLocalGraph.entries(k) == albanyLocalCol){
+          pos = k;
+          break;
+        }
+      }
+      TEUCHOS_TEST_FOR_EXCEPTION(pos == rowEnd, std::logic_error, "Error copying Peridigm Jacobian values into Albany Jacobian.\n");
+      tangentValuePositions.push_back(pos);
+    }
+  }
+
+  tangentCacheAlbanyGraph = albanyGraph;
+  tangentCachePeridigmMatrix = peridigmTangentRCP;
+  tangentCacheNumEntries = peridigmTangent.NumMyNonzeros();
+}
+
 bool LCM::PeridigmManager::copyPeridigmTangentStiffnessMatrixIntoAlbanyJacobian(Teuchos::RCP<Tpetra_CrsMatrix> jacT)
 {
   if(!peridigm->hasTangentStiffnessMatrix())
     return false;
 
-  jacT->globalAssemble();
   evaluateTangentStiffnessMatrix();
   Teuchos::RCP<const Epetra_FECrsMatrix> peridigmTangent = peridigm->getTangentStiffnessMatrix();
   //   char name[100];
   //   sprintf(name, "peridigmJac%i.mm", countJac);
   //   EpetraExt::RowMatrixToMatrixMarketFile(name, *peridigmTangent);
 
+  // The index translation depends only on the two graphs, so it is rebuilt
+  // only when either of them changes.
+  if(jacT->getCrsGraph().get() != tangentCacheAlbanyGraph.get() ||
+     peridigmTangent.get() != tangentCachePeridigmMatrix.get() ||
+     peridigmTangent->NumMyNonzeros() != tangentCacheNumEntries)
+    buildTangentCopyCache(*jacT, peridigmTangent);
+
+  // Every entry lands in a locally owned row of the Albany Jacobian, so no
+  // global assembly is needed around the copy.
+  const Tpetra_CrsMatrix::local_matrix_type albanyLocalMatrix = jacT->getLocalMatrix();
+  std::size_t k = 0;
   for(int peridigmLocalRow=0 ; peridigmLocalRow<peridigmTangent->NumMyRows() ; peridigmLocalRow++){
-
-    int globalRow = peridigmTangent->RowMatrixRowMap().GID(peridigmLocalRow);
-
     int peridigmNumEntries;
     double* peridigmValues;
     int* peridigmLocalColIndices;
     peridigmTangent->ExtractMyRowView(peridigmLocalRow, peridigmNumEntries, peridigmValues, peridigmLocalColIndices);
-
-    std::vector<int> globalColIndices(peridigmNumEntries);
-    for(int i=0 ; i<peridigmNumEntries ; i++){
-      globalColIndices[i] = peridigmTangent->ColMap().GID(peridigmLocalColIndices[i]);
-    }
-
-    LO albanyLocalRow = jacT->getRowMap()->getLocalElement(globalRow);
-
-    std::vector<LO> albanyLocalColIndices(peridigmNumEntries);
-    for(int i=0 ; i<peridigmNumEntries ; i++){
-      albanyLocalColIndices[i] = jacT->getColMap()->getLocalElement( static_cast<GO>(globalColIndices[i]) );
-    }
-    Teuchos::ArrayView<LO> albanyLocalColIndicesView(&albanyLocalColIndices[0], peridigmNumEntries);
-
-    std::vector<RealType> albanyValues(peridigmNumEntries);
-    for(int i=0 ; i<peridigmNumEntries ; i++){
-      albanyValues[i] = static_cast<RealType>(peridigmValues[i]);
-    }
-    Teuchos::ArrayView<RealType> albanyValuesView(&albanyValues[0], peridigmNumEntries);
-
-    LO numReplaced = jacT->replaceLocalValues(albanyLocalRow, albanyLocalColIndicesView, albanyValuesView);
-
-    TEUCHOS_TEST_FOR_EXCEPTION(numReplaced != peridigmNumEntries, std::logic_error, "Error copying Peridigm Jacobian values into Albany Jacobian.\n");
+    for(int i=0 ; i<peridigmNumEntries ; i++, k++)
+      albanyLocalMatrix.values(tangentValuePositions[k]) = static_cast<RealType>(peridigmValues[i]);
   }
-  jacT->globalAssemble();
 
   return true;
 }
@@ -85,11 +85,15 @@ public:
   void insertPeridigmNonzerosIntoAlbanyGraph()
   {
     stkDisc->insertPeridigmNonzerosIntoGraph();
+    invalidateTangentCopyCache();
   }
 
   //! Copy values from the Peridigm tangent stiffness matrix into the Albany jacobian.
   bool copyPeridigmTangentStiffnessMatrixIntoAlbanyJacobian(Teuchos::RCP<Tpetra_CrsMatrix> jacT);
 
+  //! Force the Peridigm-to-Albany index translation to be rebuilt on the next copy (e.g., after a topology change).
+  void invalidateTangentCopyCache();
+
   //! Evaluate the peridynamic internal force
   void evaluateInternalForce();
 
@@ -189,6 +193,18 @@ private:
 
   Teuchos::RCP<Tpetra_Vector> albanyOverlapSolutionVector;
 
+  //! Albany Jacobian graph and Peridigm tangent for which tangentValuePositions is valid.
+  //! Both are held, so that a new object cannot reuse the address of a freed one.
+  Teuchos::RCP<const Tpetra_CrsGraph> tangentCacheAlbanyGraph;
+  Teuchos::RCP<const Epetra_FECrsMatrix> tangentCachePeridigmMatrix;
+  int tangentCacheNumEntries;
+
+  //! Position in the Albany local CRS value array of each Peridigm tangent entry, in Peridigm row order.
+  std::vector<std::size_t> tangentValuePositions;
+
+  //! Map the Peridigm tangent rows and columns to the Albany Jacobian once per topology.
+  void buildTangentCopyCache(const Tpetra_CrsMatrix& jacT, const Teuchos::RCP<const Epetra_FECrsMatrix>& peridigmTangent);
+
   //! Constructor, private to prohibit use.
   PeridigmManager();
 
@@ -11,6 +11,7 @@
 #include "Albany_Utils.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_Memory.hpp"
+#include "utility/EvaluationProfiler.hpp"
 
 #include "Piro_PerformSolve.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -134,7 +135,7 @@ int main(int argc, char *argv[]) {
   Teuchos::GlobalMPISession mpiSession(&argc, &argv, NULL);
 #endif
 
-  Kokkos::initialize();
+  Kokkos::initialize(argc, argv);
 
 #ifdef ALBANY_FLUSH_DENORMALS
   _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
@@ -287,6 +288,8 @@ int main(int argc, char *argv[]) {
     if (debugParams.get<bool>("Analyze Memory", false))
       Albany::printMemoryAnalysis(std::cout, comm);
 
+    util::EvaluationProfiler::instance().write(*comm);
+
     if (writeToMatrixMarketSoln == true) { 
 
       //create serial map that puts the whole solution on processor 0
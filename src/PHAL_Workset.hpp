@@ -118,6 +118,16 @@ struct Workset {
   Teuchos::RCP<Tpetra_MultiVector> JVT;
   Teuchos::RCP<Tpetra_MultiVector> fpT;
 
+#ifdef ALBANY_ENSEMBLE
+  //Tpetra analogs of mp_x, mp_xdot, mp_xdotdot, mp_f and mp_Jac: column
+  //(entry) i holds ensemble member i. The members' Jacobians share a graph.
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xT;
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xdotT;
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xdotdotT;
+  Teuchos::RCP<Tpetra_MultiVector> mp_fT;
+  Teuchos::RCP<const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> > > mp_JacT;
+#endif
+
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Epetra_MultiVector> fpV;
   Teuchos::RCP<Epetra_MultiVector> Vp_bc;
@@ -170,6 +180,10 @@ struct Workset {
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> > > local_Vp;
 
   Kokkos::View<int***, PHX::Device> wsElNodeEqID_kokkos;
+  //! Cells grouped by color, see Albany::WorksetColoring; no offsets if the
+  //! discretization does not color its worksets
+  Kokkos::View<int*, PHX::Device> wsColorCells_kokkos;
+  Teuchos::ArrayRCP<int> wsColorOffsets;
   std::vector<PHX::index_size_type> Jacobian_deriv_dims;
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
@@ -6,6 +6,8 @@
 
 #include "QCAD_GenEigensolver.hpp"
 
+#include <algorithm>
+
 //#include "Stokhos.hpp"
 //#include "Stokhos_Epetra.hpp"
 //#include "Sacado_PCE_OrthogPoly.hpp"
@@ -60,6 +62,11 @@ GenEigensolver(const Teuchos::RCP<Teuchos::ParameterList>& eigensolveParams,
   blockSize = myParams->get<int>("Block Size",5);
   maxIters = myParams->get<int>("Maximum Iterations",500);
   conv_tol = myParams->get<double>("Convergece Tolerance",1.0e-8);
+  bWarmStart = myParams->get<bool>("Warm Start",false);
+  bReuseProblem = myParams->get<bool>("Reuse Eigenproblem",false);
+
+  numSolves = 0;
+  totalIters = 0;
 
   myComm = comm;
 }
@@ -167,8 +174,11 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
     model_inArgs.set_p(i, inArgs.get_p(i));
   
   //output args
-  Teuchos::RCP<Epetra_CrsMatrix> K = 
-    Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(model->create_W(), true);
+  if (!bReuseProblem || Teuchos::is_null(K)) {
+    K = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(model->create_W(), true);
+    M = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(model->create_W(), true);
+    eigenProblem = Teuchos::null;
+  }
   model_outArgs.set_W(K); 
 
   model->evalModel(model_inArgs, model_outArgs); //compute K matrix
@@ -176,24 +186,34 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   // reset alpha and beta to compute the mass matrix
   model_inArgs.set_alpha(1.0);
   model_inArgs.set_beta(0.0);
-  Teuchos::RCP<Epetra_CrsMatrix> M = 
-    Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(model->create_W(), true);
   model_outArgs.set_W(M); 
 
   model->evalModel(model_inArgs, model_outArgs); //compute M matrix
 
+  // Start from the previous eigenvectors if there are any; the remaining
+  //  columns of the block stay random
   Teuchos::RCP<Epetra_MultiVector> ivec = Teuchos::rcp( new Epetra_MultiVector(K->OperatorDomainMap(), blockSize) );
   ivec->Random();
 
-  // Create the eigenproblem.
-  Teuchos::RCP<Anasazi::BasicEigenproblem<double, MV, OP> > eigenProblem =
-    Teuchos::rcp( new Anasazi::BasicEigenproblem<double, MV, OP>(K, M, ivec) );
+  int nWarm = 0;
+  if (bWarmStart && Teuchos::nonnull(prevEvecs) && prevEvecs->Map().SameAs(ivec->Map())) {
+    nWarm = std::min(prevEvecs->NumVectors(), blockSize);
+    for(int i=0; i<nWarm; i++)
+      (*ivec)(i)->Update(1.0, *((*prevEvecs)(i)), 0.0);
+  }
 
-  // Inform the eigenproblem that the operator A is symmetric
-  eigenProblem->setHermitian(bHermitian);
+  // Create the eigenproblem, or point the kept one at the new initial block
+  //  (K and M were refilled in place)
+  if (Teuchos::is_null(eigenProblem)) {
+    eigenProblem = Teuchos::rcp( new Eigenproblem(K, M, ivec) );
 
-  // Set the number of eigenvalues requested
-  eigenProblem->setNEV( nev );
+    // Inform the eigenproblem that the operator A is symmetric
+    eigenProblem->setHermitian(bHermitian);
+
+    // Set the number of eigenvalues requested
+    eigenProblem->setNEV( nev );
+  }
+  else eigenProblem->setInitVec(ivec);
 
   // Inform the eigenproblem that you are finishing passing it information
   bool bSuccess = eigenProblem->setProblem();
@@ -216,12 +236,18 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
 
   // Solve the problem
   Anasazi::ReturnType returnCode = eigenSolverMan.solve();
+  int numIters = eigenSolverMan.getNumIters();
+  numSolves++;
+  totalIters += numIters;
 
   // Get the eigenvalues and eigenvectors from the eigenproblem
   Anasazi::Eigensolution<double,MV> sol = eigenProblem->getSolution();
   std::vector<Anasazi::Value<double> > evals = sol.Evals;
   Teuchos::RCP<MV> evecs = sol.Evecs;
 
+  if (bWarmStart && sol.numVecs > 0)
+    prevEvecs = Teuchos::rcp( new Epetra_MultiVector(*evecs) );
+
   std::vector<double> evals_real(sol.numVecs);
   for(int i=0; i<sol.numVecs; i++) evals_real[i] = evals[i].realpart;
 
@@ -245,6 +271,9 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   std::ostringstream os;
   os.setf(std::ios_base::right, std::ios_base::adjustfield);
   os<<"Solver manager returned " << (returnCode == Anasazi::Converged ? "converged." : "unconverged.") << std::endl;
+  os<<"Eigensolve " << numSolves << ": " << numIters << " LOBPCG iterations"
+    <<" (" << nWarm << " of " << blockSize << " initial vectors from the previous solve), "
+    << totalIters << " iterations in total" << std::endl;
   os<<std::endl;
   os<<"------------------------------------------------------"<<std::endl;
   os<<std::setw(16)<<"Eigenvalue"
@@ -13,6 +13,7 @@
 //#include "LOCA_Epetra.H"
 #include "Epetra_Map.h"
 #include "Epetra_Vector.h"
+#include "Epetra_CrsMatrix.h"
 //#include "Epetra_LocalMap.h"
 #include "EpetraExt_ModelEvaluator.h"
 #include "Teuchos_RCP.hpp"
@@ -20,6 +21,8 @@
 
 #include "Albany_StateManager.hpp"
 
+#include "AnasaziBasicEigenproblem.hpp"
+
 //#include "LOCA_Epetra_ModelEvaluatorInterface.H"
 //#include <NOX_Epetra_MultiVector.H>
 
@@ -32,6 +35,10 @@ namespace QCAD {
 
 /** \brief Epetra-based Model Evaluator for QCAD Generalized Eigensolver
  *
+ * With "Warm Start" (default false), LOBPCG starts from the eigenvectors
+ * converged in the previous call, which in a Poisson-Schrodinger loop change
+ * little between iterations.  With "Reuse Eigenproblem" (default false), the
+ * K and M matrices and the Anasazi eigenproblem are also kept across calls.
  */
 
   class GenEigensolver : public EpetraExt::ModelEvaluator {
@@ -62,6 +69,9 @@ namespace QCAD {
 
     void evalModel( const InArgs& inArgs, const OutArgs& outArgs ) const;    
 
+    //! LOBPCG iterations summed over all calls to evalModel
+    int getTotalIterations() const { return totalIters; }
+
   private:
     Teuchos::RCP<EpetraExt::ModelEvaluator> model;
     Teuchos::RCP<Albany::StateManager> observer; //use a state manager as an observer (holds eigen data)
@@ -74,6 +84,14 @@ namespace QCAD {
     std::string which;
     int nev, blockSize, maxIters;
     double conv_tol;
+    bool bWarmStart, bReuseProblem;
+
+    //Data kept between calls
+    typedef Anasazi::BasicEigenproblem<double, Epetra_MultiVector, Epetra_Operator> Eigenproblem;
+    mutable Teuchos::RCP<Epetra_MultiVector> prevEvecs;
+    mutable Teuchos::RCP<Epetra_CrsMatrix> K, M;
+    mutable Teuchos::RCP<Eigenproblem> eigenProblem;
+    mutable int numSolves, totalIters;
   };
 }
 #endif
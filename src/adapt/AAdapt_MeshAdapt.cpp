@@ -34,7 +34,8 @@ MeshAdapt(const Teuchos::RCP<Teuchos::ParameterList>& params_,
           const Teuchos::RCP<AAdapt::rc::Manager>& refConfigMgr_,
           const Teuchos::RCP<const Teuchos_Comm>& commT_)
   : AbstractAdapterT(params_, paramLib_, StateMgr_, commT_),
-    remeshFileIndex(1), rc_mgr(refConfigMgr_)
+    remeshFileIndex(1), cost_weighted_lb(false), cost_field(0),
+    rc_mgr(refConfigMgr_)
 {
   disc = StateMgr_.getDiscretization();
 
@@ -172,6 +173,8 @@ void AAdapt::MeshAdapt::initAdapt()
   // If the mesh adapt loop is run, we have to transfer state for SPR.
   if (Teuchos::nonnull(rc_mgr)) should_transfer_ip_data = true;
 
+  cost_weighted_lb = adapt_params_->get<bool>("Cost Weighted Load Balancing", false);
+
   szField->setParams(adapt_params_);
 
 }
@@ -181,6 +184,8 @@ void AAdapt::MeshAdapt::beforeAdapt()
   TEUCHOS_FUNC_TIME_MONITOR("AlbanyAdapt: Transfer to APF Mesh");
   if (should_transfer_ip_data)
     pumi_discretization->attachQPData();
+  if (cost_weighted_lb)
+    cost_field = pumi_discretization->attachElementCost();
   szField->preProcessOriginalMesh();
 }
 
@@ -202,34 +207,105 @@ namespace {
     m->end(it);
   }
 
-  void runParmaVtxElm(ma::Mesh* m, double maxImb)
+  double getElementCost(ma::Mesh* m, apf::Field* cost, ma::Entity* e)
   {
-    ma::Tag* weights = m->createDoubleTag("ma_weight",1);
-    setUnitEntWeights(m,weights,0);
-    setUnitEntWeights(m,weights,m->getDimension());
-    apf::Balancer* b = Parma_MakeVtxElmBalancer(m);
+    if (!apf::hasEntity(cost, e)) return 0;
+    const int n = apf::getShape(cost)->countNodesOn(m->getType(e));
+    double sum = 0;
+    for (int i = 0; i < n; ++i)
+      sum += apf::getScalar(cost, e, i);
+    return n ? sum / n : 0;
+  }
+
+  // Element weights from the measured cost, normalized to a global mean of 1.
+  // Elements created by adaptation that received no cost weigh 1.
+  void setCostEntWeights(ma::Mesh* m, apf::Field* cost, ma::Tag* weights)
+  {
+    const int dim = m->getDimension();
+    ma::Entity* e;
+    double sum = 0, count = 0;
+    apf::MeshIterator* it = m->begin(dim);
+    while ((e = m->iterate(it))) {
+      const double c = getElementCost(m, cost, e);
+      if (c > 0) { sum += c; ++count; }
+    }
+    m->end(it);
+    sum = PCU_Add_Double(sum);
+    count = PCU_Add_Double(count);
+    const double mean = count > 0 ? sum / count : 1;
+    it = m->begin(dim);
+    while ((e = m->iterate(it))) {
+      const double c = getElementCost(m, cost, e);
+      const double w = c > 0 ? c / mean : 1.0;
+      m->setDoubleTag(e,weights,&w);
+    }
+    m->end(it);
+  }
+
+  // Max over parts of the summed element weights, relative to the mean.
+  double getWeightImbalance(ma::Mesh* m, ma::Tag* weights)
+  {
+    ma::Entity* e;
+    double w, sum = 0;
+    apf::MeshIterator* it = m->begin(m->getDimension());
+    while ((e = m->iterate(it))) {
+      m->getDoubleTag(e,weights,&w);
+      sum += w;
+    }
+    m->end(it);
+    const double max = PCU_Max_Double(sum);
+    const double mean = PCU_Add_Double(sum) / PCU_Comm_Peers();
+    return mean > 0 ? max / mean : 1;
+  }
+
+  void balance(ma::Mesh* m, apf::Balancer* b, ma::Tag* weights, double maxImb,
+               bool report)
+  {
+    const double before = report ? getWeightImbalance(m, weights) : 0;
     b->balance(weights,maxImb);
     delete b;
+    if (report) {
+      const double after = getWeightImbalance(m, weights);
+      if (PCU_Comm_Self() == 0)
+        std::cout << "Cost-weighted element imbalance: before " << before
+                  << " after " << after << std::endl;
+    }
+  }
+
+  void runParmaVtxElm(ma::Mesh* m, double maxImb, apf::Field* cost)
+  {
+    ma::Tag* weights = m->createDoubleTag("ma_weight",1);
+    setUnitEntWeights(m,weights,0);
+    if (cost)
+      setCostEntWeights(m,cost,weights);
+    else
+      setUnitEntWeights(m,weights,m->getDimension());
+    balance(m, Parma_MakeVtxElmBalancer(m), weights, maxImb, cost);
     apf::removeTagFromDimension(m,weights,0);
     apf::removeTagFromDimension(m,weights,m->getDimension());
     m->destroyTag(weights);
   }
 
-  void runZoltanBal(ma::Mesh* m, double maxImb)
+  void runZoltanBal(ma::Mesh* m, double maxImb, apf::Field* cost)
   {
-    ma::Tag* weights = Parma_WeighByMemory(m);
-    apf::Balancer* b = makeZoltanBalancer(m, apf::GRAPH, apf::REPARTITION);
-    b->balance(weights,maxImb);
-    delete b;
+    ma::Tag* weights;
+    if (cost) {
+      weights = m->createDoubleTag("ma_weight",1);
+      setCostEntWeights(m,cost,weights);
+    } else
+      weights = Parma_WeighByMemory(m);
+    balance(m, makeZoltanBalancer(m, apf::GRAPH, apf::REPARTITION), weights,
+            maxImb, cost);
     apf::removeTagFromDimension(m,weights,m->getDimension());
     m->destroyTag(weights);
   }
 
-  void postBalance(ma::Mesh* m, std::string const& method, double maxImb) {
+  void postBalance(ma::Mesh* m, std::string const& method, double maxImb,
+                   apf::Field* cost) {
     if (method == "zoltan") {
-      runZoltanBal(m, maxImb);
+      runZoltanBal(m, maxImb, cost);
     } else if (method == "parma") {
-      runParmaVtxElm(m, maxImb);
+      runParmaVtxElm(m, maxImb, cost);
     } else if (method == "none") {
     } else {
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
@@ -248,7 +324,11 @@ void AAdapt::MeshAdapt::afterAdapt()
     adapt_params_->get<Teuchos::Array<std::string> >(
         "Load Balancing", defaultStArgs);
   double maxImb = adapt_params_->get<double>("Maximum LB Imbalance", 1.30);
-  postBalance(mesh, loadBalancing[2], maxImb);
+  postBalance(mesh, loadBalancing[2], maxImb, cost_field);
+  if (cost_field) {
+    apf::destroyField(cost_field);
+    cost_field = 0;
+  }
 
   szField->postProcessFinalMesh();
 
@@ -513,6 +593,7 @@ AAdapt::MeshAdapt::getValidAdapterParameters() const
   validPL->set<double>("Maximum LB Imbalance", 1.3, "Set maximum imbalance tolerance for predictive laod balancing");
   validPL->set<std::string>("Adaptation Displacement Vector", "", "Name of APF displacement field");
   validPL->set<bool>("Transfer IP Data", false, "Turn on solution transfer of integration point data");
+  validPL->set<bool>("Cost Weighted Load Balancing", false, "Weigh elements by their measured evaluation time when balancing after adaptation");
   validPL->set<double>("Minimum Part Density", 1000, "Minimum elements per part: triggers partition shrinking");
   validPL->set<bool>("Write Adapted SMB Files", false, "Write .smb mesh files after adaptation");
   validPL->set<std::string>("Extruded Size Method", "SPR", "Error estimator for extruded meshes");
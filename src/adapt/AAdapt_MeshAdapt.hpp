@@ -69,6 +69,11 @@ private:
 
   bool should_transfer_ip_data;
 
+  // Measured evaluation cost per element, transferred through adaptation and
+  // used to weigh elements when rebalancing.
+  bool cost_weighted_lb;
+  apf::Field* cost_field;
+
   Teuchos::RCP<rc::Manager> rc_mgr;
 
   void initRcMgr();
@@ -168,9 +168,9 @@ AAdapt::RandomFracture::adaptMesh(const Epetra_Vector& solution, const Epetra_Ve
   // end mesh update
   bulk_data_->modification_end();
 
-  // Throw away all the Albany data structures and re-build them from
-  // the mesh
-  stk_discretization_->updateMesh();
+  // Re-build the Albany data structures from the mesh; graph rows away
+  // from the fracture can be reused
+  stk_discretization_->updateMeshAfterTopologyChange();
 
 
   *output_stream_ << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~" << std::endl;
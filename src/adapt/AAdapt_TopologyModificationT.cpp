@@ -126,9 +126,10 @@ AAdapt::TopologyModT::adaptMesh() {
 
   topology_->splitOpenFaces();
 
-  // Throw away all the Albany data structures and re-build them from the mesh
+  // Re-build the Albany data structures from the mesh. Graph rows away
+  // from the opened faces can be reused.
 
-  stk_discretization_->updateMesh();
+  stk_discretization_->updateMeshAfterTopologyChange();
 
   return true;
 }
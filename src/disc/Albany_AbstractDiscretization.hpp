@@ -25,6 +25,7 @@
 #include "Shards_Array.hpp"
 #include "Albany_StateInfoStruct.hpp"
 #include "Albany_NodalDOFManager.hpp"
+#include "Albany_ElementColoring.hpp"
 #include "Albany_AbstractMeshStruct.hpp"
 
 namespace AAdapt { namespace rc { class Manager; } }
@@ -159,6 +160,13 @@ class AbstractDiscretization {
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
       getWsElNodeID() const = 0;
 
+    //! Get the coloring of the cells of each workset; empty if the
+    //! discretization does not color its worksets
+    virtual const WorksetArray<WorksetColoring>::type& getWsColoring() const {
+      static const WorksetArray<WorksetColoring>::type none;
+      return none;
+    }
+
     //! Get IDArray for (Ws, Local Node, nComps) -> (local) NodeLID, works for both scalar and vector fields
     virtual const std::vector<IDArray>& getElNodeEqID(const std::string& field_name) const = 0;
 
@@ -265,6 +273,10 @@ class AbstractDiscretization {
     //! update the mesh
     virtual void updateMesh(bool shouldTransferIPData = false) = 0;
 
+    //! Accumulate the time spent evaluating workset ws. Discretizations that
+    //! rebalance after adaptation use it to weigh elements; ignored otherwise.
+    virtual void addWorksetCost(const int ws, const double seconds) {}
+
     //! Get Numbering for layered mesh (mesh structred in one direction)
     virtual Teuchos::RCP<LayeredMeshNumbering<LO> > getLayeredMeshNumbering() = 0;
 
@@ -7,6 +7,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Albany_DiscretizationFactory.hpp"
+#include "Albany_Memory.hpp"
 #if defined(HAVE_STK)
 #include "Albany_STKDiscretization.hpp"
 #ifdef ALBANY_AERAS
@@ -419,9 +420,18 @@ Albany::DiscretizationFactory::createDiscretization(
             std::logic_error,
             "meshStruct accessed, but it has not been constructed" << std::endl);
 
-    setupInternalMeshStruct(neq, sis, side_set_sis, req, side_set_req);
-    Teuchos::RCP<Albany::AbstractDiscretization> result =
-            createDiscretizationFromInternalMeshStruct(sideSetEquations, rigidBodyModes);
+    {
+      // The mesh structs read the bulk data here; createMeshSpecs only reads
+      // the meta data.
+      MemoryPhaseGuard memoryPhase(MEMORY_PHASE_MESH_READ);
+      setupInternalMeshStruct(neq, sis, side_set_sis, req, side_set_req);
+    }
+
+    Teuchos::RCP<Albany::AbstractDiscretization> result;
+    {
+      MemoryPhaseGuard memoryPhase(MEMORY_PHASE_DISCRETIZATION_SETUP);
+      result = createDiscretizationFromInternalMeshStruct(sideSetEquations, rigidBodyModes);
+    }
 
     // Wrap the discretization in the catalyst decorator if needed.
 #ifdef ALBANY_CATALYST
@@ -0,0 +1,76 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ElementColoring.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+Albany::WorksetColoring
+Albany::colorWorkset(const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& elNodeID)
+{
+  const int numCells = elNodeID.size();
+
+  // Colors of the cells around each node, with the nodes numbered locally
+  std::unordered_map<GO, int> nodeIndex;
+  std::vector<std::vector<int> > nodeColors;
+
+  std::vector<int> color(numCells);
+  std::vector<int> taken;  // taken[c] == cell if a neighbor of cell has color c
+  std::vector<int> nodes;
+  int numColors = 0;
+
+  // Cells get the lowest color not used around their nodes, in workset
+  // order so that the cells of a color keep their relative order
+  for (int cell = 0; cell < numCells; ++cell) {
+    nodes.clear();
+    for (int j = 0; j < elNodeID[cell].size(); ++j) {
+      const std::pair<std::unordered_map<GO, int>::iterator, bool> it =
+        nodeIndex.insert(std::make_pair(elNodeID[cell][j], static_cast<int>(nodeColors.size())));
+      if (it.second) nodeColors.push_back(std::vector<int>());
+      nodes.push_back(it.first->second);
+
+      const std::vector<int>& around = nodeColors[it.first->second];
+      for (std::size_t k = 0; k < around.size(); ++k)
+        taken[around[k]] = cell;
+    }
+
+    int c = 0;
+    while (c < numColors && taken[c] == cell) ++c;
+    if (c == numColors) {
+      ++numColors;
+      taken.push_back(-1);
+    }
+    color[cell] = c;
+
+    for (std::size_t j = 0; j < nodes.size(); ++j)
+      nodeColors[nodes[j]].push_back(c);
+  }
+
+  // Counting sort of the cells by color
+  WorksetColoring coloring;
+  coloring.offsets = Teuchos::ArrayRCP<int>(numColors + 1, 0);
+  for (int cell = 0; cell < numCells; ++cell)
+    ++coloring.offsets[color[cell] + 1];
+  for (int c = 0; c < numColors; ++c)
+    coloring.offsets[c + 1] += coloring.offsets[c];
+
+  coloring.cells = Teuchos::ArrayRCP<int>(numCells);
+  std::vector<int> next(numColors);
+  for (int c = 0; c < numColors; ++c)
+    next[c] = coloring.offsets[c];
+  for (int cell = 0; cell < numCells; ++cell)
+    coloring.cells[next[color[cell]]++] = cell;
+
+  coloring.cells_kokkos = Kokkos::View<int*, PHX::Device>("wsColorCells_kokkos", numCells);
+  const Kokkos::View<int*, PHX::Device>::HostMirror cells_host =
+    Kokkos::create_mirror_view(coloring.cells_kokkos);
+  for (int i = 0; i < numCells; ++i)
+    cells_host(i) = coloring.cells[i];
+  Kokkos::deep_copy(coloring.cells_kokkos, cells_host);
+
+  return coloring;
+}
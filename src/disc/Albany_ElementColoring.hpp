@@ -0,0 +1,42 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_ELEMENTCOLORING_HPP
+#define ALBANY_ELEMENTCOLORING_HPP
+
+#include "Teuchos_ArrayRCP.hpp"
+
+#include "Albany_DataTypes.hpp"
+
+namespace Albany {
+
+/*! \brief Cells of a workset grouped by color.
+ *
+ *  No two cells of a color share a node, so they sum into disjoint rows of
+ *  the residual and the Jacobian. A scatter can then process the cells of
+ *  one color in parallel without atomics, one color after the other, and
+ *  the result does not depend on the thread schedule.
+ *
+ *  The coloring is computed once per mesh with the worksets, including the
+ *  device copy of the cells, which the fills only hand to the scatter.
+ */
+struct WorksetColoring {
+  //! Cell indices of the workset, color by color
+  Teuchos::ArrayRCP<int> cells;
+  //! Device copy of cells
+  Kokkos::View<int*, PHX::Device> cells_kokkos;
+  //! Color c holds cells[offsets[c]] to cells[offsets[c+1]-1]
+  Teuchos::ArrayRCP<int> offsets;
+
+  int numColors() const { return offsets.size() > 0 ? offsets.size() - 1 : 0; }
+};
+
+//! Greedy coloring of the cells of a workset from their (cell, node) -> node GID map
+WorksetColoring colorWorkset(const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& elNodeID);
+
+}
+
+#endif // ALBANY_ELEMENTCOLORING_HPP
@@ -6,7 +6,10 @@
 
 #include "Albany_APFDiscretization.hpp"
 
+#include <iomanip>
 #include <limits>
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_Time.hpp"
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Export.h"
 #endif
@@ -29,6 +32,7 @@
 
 #include <apfMesh.h>
 #include <apfShape.h>
+#include <apfField.h>
 #include <PCU.h>
 
 #if defined(ALBANY_EPETRA)
@@ -196,6 +200,12 @@ Albany::APFDiscretization::getWsElNodeID() const
 return wsElNodeID;
 }
 
+const Albany::WorksetArray<Albany::WorksetColoring>::type&
+Albany::APFDiscretization::getWsColoring() const
+{
+return wsColoring;
+}
+
 const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
 Albany::APFDiscretization::getCoords() const
 {
@@ -932,6 +942,7 @@ void Albany::APFDiscretization::computeWorksetInfo()
   int numBuckets = bucket_counter;
 
   wsPhysIndex.resize(numBuckets);
+  worksetCost.assign(numBuckets, 0.0);
 
   if (meshStruct->allElementBlocksHaveSamePhysics)
     for (int i=0; i<numBuckets; i++) wsPhysIndex[i]=0;
@@ -1004,6 +1015,11 @@ void Albany::APFDiscretization::computeWorksetInfo()
     }
   }
 
+  // Color the cells of each workset for the scatter, once per mesh
+  wsColoring.resize(numBuckets);
+  for (int b=0; b < numBuckets; b++)
+    wsColoring[b] = Albany::colorWorkset(wsElNodeID[b]);
+
   // (Re-)allocate storage for element data
   //
   // For each state, create storage for the data for on processor elements
@@ -1198,18 +1214,119 @@ void Albany::APFDiscretization::computeSideSets()
   m->end(it);
 }
 
+void Albany::APFDiscretization::transferQPStates(
+    std::vector<QPStateTransfer>& states,
+    const bool toAPF)
+{
+  if (states.empty())
+    return;
+  apf::Mesh2* m = meshStruct->getMesh();
+  const int spdim = meshStruct->problemDim;
+  const bool timed = meshStruct->reportQPTransferTiming;
+
+  // APF stores vectors and tensors in 3 and 3x3 components per node
+  std::size_t maxValues = 0;
+  for (std::size_t s=0; s < states.size(); ++s) {
+    states[s].time = 0;
+    maxValues = std::max(maxValues,
+        std::size_t(states[s].nqp * apf::countComponents(states[s].f)));
+  }
+  std::vector<double> buf(maxValues, 0.0);
+  std::vector<double*> data(states.size());
+
+  for (std::size_t b=0; b < buckets.size(); ++b) {
+    std::vector<apf::MeshEntity*>& buck = buckets[b];
+    if (buck.empty())
+      continue;
+    Albany::StateArray& esa = stateArrays.elemStateArrays[b];
+    for (std::size_t s=0; s < states.size(); ++s) {
+      data[s] = esa[states[s].name].contiguous_data();
+      assert(apf::getShape(states[s].f)->countNodesOn(m->getType(buck[0]))
+             == states[s].nqp);
+    }
+
+    // One state at a time over the bucket, so that the timer is read once
+    // per state and bucket rather than once per element
+    for (std::size_t s=0; s < states.size(); ++s) {
+      const double start = timed ? Teuchos::Time::wallTime() : 0;
+      const QPStateTransfer& st = states[s];
+      apf::FieldDataOf<double>* fd = st.f->getData();
+      const int n = st.rank == 0 ? 1 : (st.rank == 1 ? spdim : spdim*spdim);
+      for (std::size_t e=0; e < buck.size(); ++e) {
+        // values of the element in the natural-order state array
+        double* ar = data[s] + e*st.nqp*n;
+        if (st.rank == 0 || spdim == 3) {
+          // same layout on both sides
+          if (toAPF) fd->set(buck[e], ar);
+          else fd->get(buck[e], ar);
+        } else if (toAPF) {
+          std::fill(buf.begin(), buf.end(), 0.0);
+          for (int p=0; p < st.nqp; ++p) {
+            if (st.rank == 1) {
+              for (int i=0; i < spdim; ++i)
+                buf[3*p + i] = ar[spdim*p + i];
+            } else {
+              for (int i=0; i < spdim; ++i)
+                for (int j=0; j < spdim; ++j)
+                  buf[9*p + 3*i + j] = ar[n*p + spdim*i + j];
+            }
+          }
+          fd->set(buck[e], &buf[0]);
+        } else {
+          fd->get(buck[e], &buf[0]);
+          for (int p=0; p < st.nqp; ++p) {
+            if (st.rank == 1) {
+              for (int i=0; i < spdim; ++i)
+                ar[spdim*p + i] = buf[3*p + i];
+            } else {
+              for (int i=0; i < spdim; ++i)
+                for (int j=0; j < spdim; ++j)
+                  ar[n*p + spdim*i + j] = buf[9*p + 3*i + j];
+            }
+          }
+        }
+      }
+      if (timed)
+        states[s].time += Teuchos::Time::wallTime() - start;
+    }
+  }
+
+  if (timed)
+    reportQPTransfer(states, toAPF ? "to APF" : "from APF");
+}
+
+void Albany::APFDiscretization::reportQPTransfer(
+    const std::vector<QPStateTransfer>& states,
+    const char* direction) const
+{
+  const int n = states.size();
+  std::vector<double> times(n), maxTimes(n);
+  for (int s=0; s < n; ++s)
+    times[s] = states[s].time;
+  Teuchos::reduceAll<int, double>(*commT, Teuchos::REDUCE_MAX, n, &times[0],
+                                  &maxTimes[0]);
+  if (commT->getRank() != 0)
+    return;
+  double total = 0;
+  *out << "QP state transfer " << direction << " (max over ranks):\n";
+  for (int s=0; s < n; ++s) {
+    *out << "  " << std::setw(40) << std::left << states[s].name << " "
+         << std::scientific << std::setprecision(3) << maxTimes[s] << " s\n";
+    total += maxTimes[s];
+  }
+  *out << "  " << std::setw(40) << std::left << "total" << " "
+       << std::scientific << std::setprecision(3) << total << " s"
+       << std::endl;
+}
+
 void Albany::APFDiscretization::copyQPScalarToAPF(
     unsigned nqp,
     std::string const& stateName,
     apf::Field* f)
 {
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e)
-      for (std::size_t p=0; p < nqp; ++p)
-        apf::setScalar(f,buck[e],p,ar(e,p));
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 0, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, true);
 }
 
 void Albany::APFDiscretization::copyQPVectorToAPF(
@@ -1217,19 +1334,9 @@ void Albany::APFDiscretization::copyQPVectorToAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i)
-          v[i] = ar(e,p,i);
-        apf::setVector(f,buck[e],p,v);
-      }
-    }
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 1, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, true);
 }
 
 void Albany::APFDiscretization::copyQPTensorToAPF(
@@ -1237,20 +1344,9 @@ void Albany::APFDiscretization::copyQPTensorToAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i)
-          for (std::size_t j=0; j < spdim; ++j)
-            v[i][j] = ar(e,p,i,j);
-        apf::setMatrix(f,buck[e],p,v);
-      }
-    }
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 2, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, true);
 }
 
 void Albany::APFDiscretization::copyQPStatesToAPF(
@@ -1259,13 +1355,15 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
     bool copyAll)
 {
   apf::Mesh2* m = meshStruct->getMesh();
+  std::vector<QPStateTransfer> states;
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
     if (!copyAll && !state.output)
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::SCALAR,fs);
-    copyQPScalarToAPF(nqp, state.name, f);
+    QPStateTransfer st = {state.name, f, nqp, 0, 0};
+    states.push_back(st);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
@@ -1273,7 +1371,8 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::VECTOR,fs);
-    copyQPVectorToAPF(nqp, state.name, f);
+    QPStateTransfer st = {state.name, f, nqp, 1, 0};
+    states.push_back(st);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
@@ -1281,8 +1380,10 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::MATRIX,fs);
-    copyQPTensorToAPF(nqp, state.name, f);
+    QPStateTransfer st = {state.name, f, nqp, 2, 0};
+    states.push_back(st);
   }
+  transferQPStates(states, true);
   if (meshStruct->saveStabilizedStress)
     saveStabilizedStress();
 }
@@ -1309,16 +1410,9 @@ void Albany::APFDiscretization::copyQPScalarFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  apf::Mesh2* m = meshStruct->getMesh();
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p = 0; p < nqp; ++p) {
-        ar(e,p) = apf::getScalar(f,buck[e],p);
-      }
-    }
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 0, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, false);
 }
 
 void Albany::APFDiscretization::copyQPVectorFromAPF(
@@ -1326,20 +1420,9 @@ void Albany::APFDiscretization::copyQPVectorFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getVector(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i)
-          ar(e,p,i) = v[i];
-      }
-    }
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 1, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, false);
 }
 
 void Albany::APFDiscretization::copyQPTensorFromAPF(
@@ -1347,49 +1430,44 @@ void Albany::APFDiscretization::copyQPTensorFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b = 0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getMatrix(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i) {
-          for (std::size_t j=0; j < spdim; ++j)
-            ar(e,p,i,j) = v[i][j];
-        }
-      }
-    }
-  }
+  QPStateTransfer st = {stateName, f, int(nqp), 2, 0};
+  std::vector<QPStateTransfer> states(1, st);
+  transferQPStates(states, false);
 }
 
 void Albany::APFDiscretization::copyQPStatesFromAPF()
 {
   apf::Mesh2* m = meshStruct->getMesh();
   apf::Field* f;
+  std::vector<QPStateTransfer> states;
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
     int nqp = state.dims[1];
     f = m->findField(state.name.c_str());
-    if (f)
-      copyQPScalarFromAPF(nqp, state.name, f);
+    if (f) {
+      QPStateTransfer st = {state.name, f, nqp, 0, 0};
+      states.push_back(st);
+    }
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
     int nqp = state.dims[1];
     f = m->findField(state.name.c_str());
-    if (f)
-      copyQPVectorFromAPF(nqp, state.name, f);
+    if (f) {
+      QPStateTransfer st = {state.name, f, nqp, 1, 0};
+      states.push_back(st);
+    }
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
     int nqp = state.dims[1];
     f = m->findField(state.name.c_str());
-    if (f)
-      copyQPTensorFromAPF(nqp, state.name, f);
+    if (f) {
+      QPStateTransfer st = {state.name, f, nqp, 2, 0};
+      states.push_back(st);
+    }
   }
+  transferQPStates(states, false);
 }
 
 void Albany::APFDiscretization::
@@ -1519,6 +1597,26 @@ Albany::APFDiscretization::detachQPData() {
   removeQPStatesFromAPF();
 }
 
+apf::Field*
+Albany::APFDiscretization::attachElementCost() {
+  apf::Mesh2* m = meshStruct->getMesh();
+  int dim = m->getDimension();
+  // Same shape as the qp states, which mesh adaptation transfers.
+  apf::FieldShape* fs = apf::getVoronoiShape(dim, meshStruct->cubatureDegree);
+  assert(fs);
+  apf::Field* f = apf::createField(m, "albany_cost", apf::SCALAR, fs);
+  for (std::size_t b=0; b < buckets.size(); ++b) {
+    std::vector<apf::MeshEntity*>& buck = buckets[b];
+    const double cost = buck.empty() ? 0 : worksetCost[b] / buck.size();
+    for (std::size_t e=0; e < buck.size(); ++e) {
+      const int nqp = fs->countNodesOn(m->getType(buck[e]));
+      for (int qp=0; qp < nqp; ++qp)
+        apf::setScalar(f, buck[e], qp, cost);
+    }
+  }
+  return f;
+}
+
 static apf::Field* interpolate(
     apf::Field* nf,
     int cubatureDegree,
@@ -97,6 +97,9 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     //! Get map from (Ws, El, Local Node) -> NodeGID
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type& getWsElNodeID() const;
 
+    //! Get the coloring of the cells of each workset (no two cells of a color share a node)
+    const Albany::WorksetArray<Albany::WorksetColoring>::type& getWsColoring() const;
+
     //! Get coordinate vector (overlap map, interleaved)
     const Teuchos::ArrayRCP<double>& getCoordinates() const;
     //! Set coordinate vector (overlap map, interleaved)
@@ -186,6 +189,16 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     // After mesh modification, qp data needs to be removed
     void detachQPData();
 
+    void addWorksetCost(const int ws, const double seconds) {
+      worksetCost[ws] += seconds;
+    }
+
+    //! Before mesh modification, store the evaluation time per element,
+    //! measured since the last call to computeWorksetInfo, in an element
+    //! field so that it is transferred to the adapted mesh. The caller
+    //! destroys the field.
+    apf::Field* attachElementCost();
+
     // After mesh modification, need to update the element connectivity and nodal coordinates
     void updateMesh(bool shouldTransferIPData);
     // The parameter library is used to update Time after adapting
@@ -344,6 +357,25 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     //! Write stabilized stress out to file
     void saveStabilizedStress();
 
+    //! A QP state and the APF field it is transferred to or from
+    struct QPStateTransfer {
+      std::string name;
+      apf::Field* f;
+      int nqp;
+      int rank;   // 0: scalar, 1: vector, 2: tensor
+      double time;
+    };
+
+    /*! Move the given QP states between the state arrays and their APF
+     *  fields, element by element: all the states of an element are
+     *  moved before the next element, and each state is packed into a
+     *  contiguous buffer and set or read with a single APF call per
+     *  element instead of one call per integration point.
+     */
+    void transferQPStates(std::vector<QPStateTransfer>& states, const bool toAPF);
+    void reportQPTransfer(const std::vector<QPStateTransfer>& states,
+                          const char* direction) const;
+
     // Transfer nodal data to/from APF.
     void copyNodalDataToAPF(const bool copy_all);
     void removeNodalDataFromAPF();
@@ -443,6 +475,9 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     //! Connectivity array [workset, element, local-node] => GID
     Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type wsElNodeID;
 
+    //! Coloring of the cells of each workset, recomputed with the worksets
+    Albany::WorksetArray<Albany::WorksetColoring>::type wsColoring;
+
     mutable Teuchos::ArrayRCP<double> coordinates;
     Teuchos::RCP<Tpetra_MultiVector> coordMV;
     Albany::WorksetArray<std::string>::type wsEBNames;
@@ -474,6 +509,7 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     bool interleavedOrdering;
 
     std::vector< std::vector<apf::MeshEntity*> > buckets; // bucket of elements
+    std::vector<double> worksetCost; // evaluation time per bucket
 
     // storage to save the node coordinates of the nodesets visible to this PE
     std::map<std::string, std::vector<double> > nodeset_node_coords;
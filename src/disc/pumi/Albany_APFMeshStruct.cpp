@@ -145,6 +145,7 @@ void Albany::APFMeshStruct::init(
   useTemperatureHack = params->get<bool>("QP Temperature from Nodes", false);
   useDOFOffsetHack = params->get<bool>("Offset DOF Hack", false);
   saveStabilizedStress = params->get<bool>("Save Stabilized Stress", false);
+  reportQPTransferTiming = params->get<bool>("Report QP Transfer Timing", false);
 
   compositeTet = false;
 
@@ -544,6 +545,9 @@ Albany::APFMeshStruct::getValidDiscretizationParameters() const
 
   validPL->set<bool>("Write ASCII VTK Files", false, "");
 
+  validPL->set<bool>("Report QP Transfer Timing", false,
+      "Print the time spent moving each QP state to and from APF fields");
+
   return validPL;
 }
 
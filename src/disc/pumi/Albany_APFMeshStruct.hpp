@@ -145,6 +145,8 @@ class APFMeshStruct : public Albany::AbstractMeshStruct {
 
     bool saveStabilizedStress;
 
+    bool reportQPTransferTiming;
+
     // Number of distinct solution vectors handled (<=3)
     int num_time_deriv;
 
@@ -96,6 +96,15 @@ namespace Albany {
     //boolean flag for writing coordinates to matrix market file (e.g., for ML analysis)
     bool writeCoordsToMMFile;
 
+    //Local numbering of the nodes: "Mesh", "Workset" or "RCM"
+    std::string nodeOrdering;
+
+    //Reuse the Jacobian graph rows that a topology change does not touch
+    bool incrementalGraphUpdate;
+
+    //Per-rank cache of the Jacobian graph; empty if not used
+    std::string graphCacheFile;
+
     // Info to map element block to physics set
     bool allElementBlocksHaveSamePhysics;
     std::map<std::string, int> ebNameToIndex;
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 #include "Tpetra_ComputeGatherMap.hpp"
 
 #include "Albany_DiscretizationFactory.hpp"
@@ -219,6 +220,15 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
 
   transferSolutionToCoords = params->get<bool>("Transfer Solution to Coordinates", false);
 
+  nodeOrdering = params->get<std::string>("Node Ordering", "Mesh");
+  TEUCHOS_TEST_FOR_EXCEPTION(nodeOrdering != "Mesh" && nodeOrdering != "Workset" && nodeOrdering != "RCM",
+      Teuchos::Exceptions::InvalidParameter, std::endl << "Error!  Unknown Node Ordering in GenericSTKMeshStruct: "
+      << nodeOrdering << "!" << std::endl << "Valid orderings are: Mesh, Workset, RCM" << std::endl);
+
+  incrementalGraphUpdate = params->get<bool>("Incremental Graph Update", false);
+
+  graphCacheFile = params->get<std::string>("Jacobian Graph Cache File", "");
+
 #ifdef ALBANY_STK_PERCEPT
   // Build the eMesh if needed
   if(buildEMesh)
@@ -577,6 +587,7 @@ void Albany::GenericSTKMeshStruct::rebalanceInitialMeshT(const Teuchos::RCP<cons
 
   if(rebalance || (useSerialMesh && commT->getSize() > 1)){
 
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STK rebalance");
     rebalanceAdaptedMeshT(params, commT);
 
   }
@@ -1636,6 +1647,12 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Use Composite Tet 10", false, "Flag to use the composite tet 10 basis in Intrepid");
   validPL->set<bool>("Build Node Sets From Side Sets",false,"Flag to build node sets from side sets");
+  validPL->set<std::string>("Node Ordering", "Mesh",
+      "Local numbering of the nodes and unknowns: Mesh (STK bucket order), Workset (order of first use by the worksets) or RCM (reverse Cuthill-McKee)");
+  validPL->set<bool>("Incremental Graph Update", false,
+      "After fracture, copy the Jacobian graph rows of nodes whose elements did not change instead of rebuilding them (holds the old graph during the update)");
+  validPL->set<std::string>("Jacobian Graph Cache File", "",
+      "Base name of the per-rank files that hold the local Jacobian graph of the initial mesh, reused by later runs on the same mesh and decomposition");
 
   validPL->sublist("Required Fields Info", false, "Info for the creation of the required fields in the STK mesh");
 
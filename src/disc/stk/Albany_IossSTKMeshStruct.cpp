@@ -11,6 +11,7 @@
 
 #include "Albany_IossSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 
 #include <Shards_BasicTopologies.hpp>
 
@@ -107,8 +108,11 @@ Albany::IossSTKMeshStruct::IossSTKMeshStruct(
     file_name = params->get<std::string>("Pamgen Input File Name");
   }
 
-  mesh_data->add_mesh_database(file_name, mesh_type, stk::io::READ_MESH);
-  mesh_data->create_input_mesh();
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STK read mesh metadata");
+    mesh_data->add_mesh_database(file_name, mesh_type, stk::io::READ_MESH);
+    mesh_data->create_input_mesh();
+  }
 
   metaData = mesh_data->meta_data_rcp();//Teuchos::rcpFromRef(mesh_data->meta_data());
 
@@ -310,6 +314,7 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
 
 
       //stk::io::process_mesh_bulk_data(region, *bulkData);
+      TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STK populate bulk data");
       mesh_data->populate_bulk_data();
 
       //bulkData = &mesh_data->bulk_data();
@@ -350,6 +355,7 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
      */
 
   { // running in Serial or Parallel read from Nemspread files
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STK populate bulk data");
     bulkData->modification_begin();
     mesh_data->populate_bulk_data();
     if (!usePamgen)
@@ -11,10 +11,15 @@
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_BucketArray.hpp"
+#include "Albany_Memory.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
 
 #include <Shards_BasicTopologies.hpp>
 
@@ -45,6 +50,8 @@ extern "C" {
 #endif
 
 #include <algorithm>
+#include <cstdlib>
+#include <set>
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Export.h"
 #include "EpetraExt_MultiVectorOut.h"
@@ -79,7 +86,8 @@ STKDiscretization(Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct_,
   neq(stkMeshStruct_->neq),
   stkMeshStruct(stkMeshStruct_),
   sideSetEquations(sideSetEquations_),
-  interleavedOrdering(stkMeshStruct_->interleavedOrdering)
+  interleavedOrdering(stkMeshStruct_->interleavedOrdering),
+  incrementalGraphUpdate(false)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(commT_);
@@ -265,6 +273,12 @@ Albany::STKDiscretization::getWsElNodeID() const
   return wsElNodeID;
 }
 
+const Albany::WorksetArray<Albany::WorksetColoring>::type&
+Albany::STKDiscretization::getWsColoring() const
+{
+  return wsColoring;
+}
+
 const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
 Albany::STKDiscretization::getCoords() const
 {
@@ -351,6 +365,7 @@ setReferenceConfigurationManager(const Teuchos::RCP<AAdapt::rc::Manager>& rcm)
 void
 Albany::STKDiscretization::transformMesh()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc transform mesh");
   using std::cout; using std::endl;
   AbstractSTKFieldContainer::VectorFieldType* coordinates_field = stkMeshStruct->getCoordinatesField();
   std::string transformType = stkMeshStruct->transformType;
@@ -653,6 +668,7 @@ void Albany::STKDiscretization::writeSolution(const Epetra_Vector& soln, const d
 void Albany::STKDiscretization::writeSolutionT(
   const Tpetra_Vector& solnT, const double time, const bool overlapped)
 {
+  Albany::MemoryPhaseGuard memoryPhase(Albany::MEMORY_PHASE_OUTPUT);
   writeSolutionToMeshDatabaseT(solnT, time, overlapped);
   writeSolutionToFileT(solnT, time, overlapped);
 }
@@ -660,6 +676,7 @@ void Albany::STKDiscretization::writeSolutionT(
 void Albany::STKDiscretization::writeSolutionMV(
   const Tpetra_MultiVector& solnT, const double time, const bool overlapped)
 {
+  Albany::MemoryPhaseGuard memoryPhase(Albany::MEMORY_PHASE_OUTPUT);
   writeSolutionMVToMeshDatabase(solnT, time, overlapped);
   writeSolutionMVToFile(solnT, time, overlapped);
 }
@@ -1159,6 +1176,12 @@ GO Albany::STKDiscretization::getGlobalDOF(const GO inode, const int eq) const
   else  return inode + numGlobalNodes*eq;
 }
 
+GO Albany::STKDiscretization::getGlobalNode(const GO dof) const
+{
+  if (interleavedOrdering) return dof / neq;
+  else  return dof % numGlobalNodes;
+}
+
 int Albany::STKDiscretization::nonzeroesPerRow(const int neq) const
 {
   int numDim = stkMeshStruct->numDim;
@@ -1176,6 +1199,7 @@ int Albany::STKDiscretization::nonzeroesPerRow(const int neq) const
 
 void Albany::STKDiscretization::computeNodalMaps (bool overlapped)
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc nodal maps");
   // Loads member data:  ownednodes, numOwnedNodes, node_map, numGlobalNodes, map
   // maps for owned nodes and unknowns
 
@@ -1219,6 +1243,19 @@ void Albany::STKDiscretization::computeNodalMaps (bool overlapped)
                 bulkData.buckets( stk::topology::NODE_RANK ) ,
                 nodes );
 
+    if (!nodeRank.empty()) {
+      std::vector<std::pair<int, stk::mesh::Entity> > ranked(nodes.size());
+      for (int i=0; i < nodes.size(); i++) {
+        auto r = nodeRank.find(gid(nodes[i]));
+        ranked[i] = std::make_pair(r != nodeRank.end() ? r->second : static_cast<int>(nodeRank.size()) + i, nodes[i]);
+      }
+      std::sort(ranked.begin(), ranked.end(),
+                [](const std::pair<int, stk::mesh::Entity>& a, const std::pair<int, stk::mesh::Entity>& b)
+                { return a.first < b.first; });
+      for (int i=0; i < nodes.size(); i++)
+        nodes[i] = ranked[i].second;
+    }
+
     numNodes = nodes.size();
 
     Teuchos::Array<GO> indicesT(numNodes*nComp);
@@ -1244,8 +1281,117 @@ void Albany::STKDiscretization::computeNodalMaps (bool overlapped)
   }
 }
 
+void Albany::STKDiscretization::computeNodeOrdering()
+{
+  nodeRank.clear();
+  const std::string& ordering = stkMeshStruct->nodeOrdering;
+  if (ordering.empty() || ordering == "Mesh") return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc node ordering");
+
+  std::vector<stk::mesh::Entity> nodes;
+  stk::mesh::get_selected_entities( metaData.locally_owned_part() | metaData.globally_shared_part() ,
+                  bulkData.buckets( stk::topology::NODE_RANK ) ,
+                  nodes );
+  const int num_nodes = nodes.size();
+
+  std::map<GO, int> index;
+  for (int i=0; i < num_nodes; i++)
+    index[gid(nodes[i])] = i;
+
+  // Local node graph through the owned elements, in CSR form
+  std::vector<int> offsets(1, 0), adj;
+  std::vector<GO> node_gids;
+  for (int i=0; i < num_nodes; i++) {
+    getCoupledNodeGIDs(nodes[i], node_gids);
+    for (std::size_t l=0; l < node_gids.size(); l++) {
+      auto j = index.find(node_gids[l]);
+      if (j != index.end() && j->second != i)
+        adj.push_back(j->second);
+    }
+    offsets.push_back(adj.size());
+  }
+
+  std::vector<int> order;
+  order.reserve(num_nodes);
+  std::vector<char> numbered(num_nodes, 0);
+
+  if (ordering == "Workset") {
+    // Number the nodes as the worksets first use them, so that the gathers
+    // and scatters of a workset touch a narrow range of unknowns.
+    stk::mesh::Selector select_owned_in_part =
+      stk::mesh::Selector( metaData.universal_part() ) &
+      stk::mesh::Selector( metaData.locally_owned_part() );
+    stk::mesh::BucketVector const& buckets = bulkData.get_buckets( stk::topology::ELEMENT_RANK, select_owned_in_part );
+    for (std::size_t b=0; b < buckets.size(); b++) {
+      stk::mesh::Bucket& buck = *buckets[b];
+      for (std::size_t i=0; i < buck.size(); i++) {
+        stk::mesh::Entity const* node_rels = bulkData.begin_nodes(buck[i]);
+        const size_t num_elem_nodes = bulkData.num_nodes(buck[i]);
+        for (std::size_t j=0; j < num_elem_nodes; j++) {
+          auto k = index.find(gid(node_rels[j]));
+          if (k != index.end() && !numbered[k->second]) {
+            numbered[k->second] = 1;
+            order.push_back(k->second);
+          }
+        }
+      }
+    }
+  } else {
+    // Reverse Cuthill-McKee: breadth-first from a node of minimum degree in
+    // each connected component, visiting neighbors by increasing degree.
+    std::vector<int> by_degree(num_nodes);
+    for (int i=0; i < num_nodes; i++) by_degree[i] = i;
+    std::stable_sort(by_degree.begin(), by_degree.end(), [&](int a, int b)
+        { return offsets[a+1] - offsets[a] < offsets[b+1] - offsets[b]; });
+
+    std::vector<int> neighbors;
+    for (int s=0; s < num_nodes; s++) {
+      if (numbered[by_degree[s]]) continue;
+      numbered[by_degree[s]] = 1;
+      order.push_back(by_degree[s]);
+      for (std::size_t head=order.size()-1; head < order.size(); head++) {
+        const int i = order[head];
+        neighbors.clear();
+        for (int k=offsets[i]; k < offsets[i+1]; k++)
+          if (!numbered[adj[k]]) {
+            numbered[adj[k]] = 1;
+            neighbors.push_back(adj[k]);
+          }
+        std::stable_sort(neighbors.begin(), neighbors.end(), [&](int a, int b)
+            { return offsets[a+1] - offsets[a] < offsets[b+1] - offsets[b]; });
+        order.insert(order.end(), neighbors.begin(), neighbors.end());
+      }
+    }
+    std::reverse(order.begin(), order.end());
+  }
+
+  // Nodes that are not on an owned element keep their relative order at the end
+  for (int i=0; i < num_nodes; i++)
+    if (!numbered[i]) order.push_back(i);
+
+  std::vector<int> position(num_nodes);
+  for (int k=0; k < num_nodes; k++) {
+    position[order[k]] = k;
+    nodeRank[gid(nodes[order[k]])] = k;
+  }
+
+  // Bandwidth of the local node graph before and after
+  int bandwidth_before(0), bandwidth_after(0);
+  for (int i=0; i < num_nodes; i++)
+    for (int k=offsets[i]; k < offsets[i+1]; k++) {
+      bandwidth_before = std::max(bandwidth_before, std::abs(i - adj[k]));
+      bandwidth_after = std::max(bandwidth_after, std::abs(position[i] - position[adj[k]]));
+    }
+
+  if (commT->getRank()==0)
+    *out << "STKDisc: " << ordering << " node ordering changed the local node graph bandwidth from "
+         << bandwidth_before << " to " << bandwidth_after << " on Proc 0" << std::endl;
+}
+
 void Albany::STKDiscretization::computeOwnedNodesAndUnknowns()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc owned nodes");
   // Loads member data:  ownednodes, numOwnedNodes, node_map, numGlobalNodes, map
   // maps for owned nodes and unknowns
   stk::mesh::Selector select_owned_in_part =
@@ -1295,6 +1441,7 @@ void Albany::STKDiscretization::computeOwnedNodesAndUnknowns()
 
 void Albany::STKDiscretization::computeOverlapNodesAndUnknowns()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc overlap nodes");
   // maps for overlap unknowns
   stk::mesh::Selector select_overlap_in_part =
     stk::mesh::Selector( metaData.universal_part() ) &
@@ -1345,8 +1492,23 @@ void Albany::STKDiscretization::computeOverlapNodesAndUnknowns()
 
 void Albany::STKDiscretization::computeGraphs()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc graphs");
+  Albany::MemoryPhaseGuard memoryPhase(Albany::MEMORY_PHASE_GRAPH_CONSTRUCTION);
+
+  // Only the graph of the initial mesh is cached, and it only holds the
+  // rows built from element connectivity, so side set equations always
+  // take the full path.
+  const bool use_cache = Teuchos::is_null(overlap_graphT) &&
+    sideSetEquations.empty() && !stkMeshStruct->graphCacheFile.empty();
+  if (use_cache && readGraphCache()) {
+    computeOwnedGraph();
+    return;
+  }
+
   computeGraphsUpToFillComplete();
   fillCompleteGraphs();
+  if (use_cache)
+    writeGraphCache();
 }
 
 void Albany::STKDiscretization::computeGraphsUpToFillComplete()
@@ -1357,6 +1519,10 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
 
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map, coordinates, graphs
 
+  // Keep the previous graph around in case only a few of its rows change
+  Teuchos::RCP<const Tpetra_CrsGraph> old_overlap_graphT;
+  if (incrementalGraphUpdate)
+    old_overlap_graphT = overlap_graphT;
   overlap_graphT = Teuchos::null; // delete existing graph happens here on remesh
 
   overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, neq*nodes_per_element));
@@ -1385,33 +1551,47 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
     }
   }
 
-  for (std::size_t i=0; i < cells.size(); i++) {
-    stk::mesh::Entity e = cells[i];
-    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
-    const size_t num_nodes = bulkData.num_nodes(e);
-
-    // loop over local nodes
-    for (std::size_t j=0; j < num_nodes; j++) {
-      stk::mesh::Entity rowNode = node_rels[j];
+  // After a local topology change, most rows are unchanged. Blocked
+  // ordering renumbers all DOFs when the number of nodes changes, and side
+  // set equations add rows that do not come from element connectivity, so
+  // those cases always take the full path.
+  const bool incremental = incrementalGraphUpdate && interleavedOrdering &&
+    sideSetEquations.empty() && Teuchos::nonnull(old_overlap_graphT) &&
+    old_overlap_graphT->isFillComplete();
+
+  if (incremental) {
+    computeGraphsIncrementally(old_overlap_graphT, globalEqns);
+  } else {
+    // Insert each row once with all of its columns, rather than once per
+    // element around the node, so that the graph does not have to merge
+    // the duplicate columns of the shared nodes.
+    std::vector<GO> node_gids;
+    Teuchos::Array<GO> cols;
+    for (std::size_t inode=0; inode < overlapnodes.size(); ++inode) {
+      stk::mesh::Entity node = overlapnodes[inode];
+      getCoupledNodeGIDs(node, node_gids);
+      if (node_gids.empty()) continue;
+
+      // Note: here we cycle through ALL the eqns (not just the global ones),
+      //       since they could all be coupled with this eq
+      cols.resize(node_gids.size()*neq);
+      for (std::size_t l=0; l < node_gids.size(); l++)
+        for (std::size_t m=0; m < neq; m++)
+          cols[l*neq+m] = getGlobalDOF(node_gids[l], m);
 
       // loop over eqs
       for (std::size_t k=0; k < globalEqns.size(); ++k)
       {
-        row = getGlobalDOF(gid(rowNode), globalEqns[k]);
-        for (std::size_t l=0; l < num_nodes; l++)
-        {
-          stk::mesh::Entity colNode = node_rels[l];
-          for (std::size_t m=0; m < neq; m++) // Note: here we cycle through ALL the eqns (not just the global ones),
-          {                                   //       since they could all be coupled with this eq
-            col = getGlobalDOF(gid(colNode), m);
-            colAV = Teuchos::arrayView(&col, 1);
-            overlap_graphT->insertGlobalIndices(row, colAV);
-          }
-        }
+        row = getGlobalDOF(gid(node), globalEqns[k]);
+        overlap_graphT->insertGlobalIndices(row, cols());
       }
     }
   }
 
+  old_overlap_graphT = Teuchos::null;
+  if (stkMeshStruct->incrementalGraphUpdate)
+    recordGraphConnectivity();
+
   if (sideSetEquations.size()>0)
   {
     // iterator over all sideSet-defined equations
@@ -1482,7 +1662,11 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
 void Albany::STKDiscretization::fillCompleteGraphs()
 {
   overlap_graphT->fillComplete();
+  computeOwnedGraph();
+}
 
+void Albany::STKDiscretization::computeOwnedGraph()
+{
   // Create Owned graph by exporting overlap with known row map
   graphT = Teuchos::null; // delete existing graph happens here on remesh
 
@@ -1494,6 +1678,334 @@ void Albany::STKDiscretization::fillCompleteGraphs()
   graphT->fillComplete();
 }
 
+void Albany::STKDiscretization::computeGraphsIncrementally(
+  const Teuchos::RCP<const Tpetra_CrsGraph>& old_overlap_graphT,
+  const std::vector<int>& globalEqns)
+{
+  // With blocked ordering the DOF numbers of all nodes change with the
+  // number of nodes, so the old rows cannot be copied.
+  TEUCHOS_TEST_FOR_EXCEPTION(!interleavedOrdering, std::logic_error,
+    "Error! The incremental graph update requires interleaved DOF ordering.\n");
+
+  const Teuchos::RCP<const Tpetra_Map> old_row_mapT = old_overlap_graphT->getRowMap();
+
+  // A row must be rebuilt if any element around its node is new, is gone or
+  // has a different connectivity than when the old graph was built. The
+  // nodes an element was attached to before the change count as well:
+  // splitOpenFaces moves elements from an existing node to a new one, and
+  // the existing node loses the coupling through the moved elements.
+  std::set<GO> touched_nodes;
+  std::vector<char> old_cell_found(graphCellGIDs.size(), 0);
+  for (std::size_t i=0; i < cells.size(); i++) {
+    stk::mesh::Entity e = cells[i];
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
+    const size_t num_nodes = bulkData.num_nodes(e);
+
+    const std::vector<GO>::const_iterator it =
+      std::lower_bound(graphCellGIDs.begin(), graphCellGIDs.end(), gid(e));
+    bool changed = true;
+    if (it != graphCellGIDs.end() && *it == gid(e)) {
+      const std::size_t old_cell = it - graphCellGIDs.begin();
+      const std::size_t begin = graphCellNodeOffsets[old_cell];
+      const std::size_t end = graphCellNodeOffsets[old_cell+1];
+      old_cell_found[old_cell] = 1;
+
+      changed = end - begin != num_nodes;
+      for (std::size_t j=0; j < num_nodes && !changed; j++)
+        changed = graphCellNodeGIDs[begin+j] != gid(node_rels[j]);
+      if (changed)
+        touched_nodes.insert(graphCellNodeGIDs.begin() + begin, graphCellNodeGIDs.begin() + end);
+    }
+
+    if (changed)
+      for (std::size_t j=0; j < num_nodes; j++)
+        touched_nodes.insert(gid(node_rels[j]));
+  }
+
+  // Elements that are no longer owned
+  for (std::size_t old_cell=0; old_cell < graphCellGIDs.size(); old_cell++)
+    if (!old_cell_found[old_cell])
+      touched_nodes.insert(graphCellNodeGIDs.begin() + graphCellNodeOffsets[old_cell],
+                           graphCellNodeGIDs.begin() + graphCellNodeOffsets[old_cell+1]);
+
+  std::vector<GO> node_gids;
+  Teuchos::Array<GO> cols, old_cols;
+  std::size_t num_copied(0), num_rebuilt(0);
+
+  for (std::size_t inode=0; inode < overlapnodes.size(); ++inode) {
+    stk::mesh::Entity node = overlapnodes[inode];
+    const GO node_gid = gid(node);
+    const bool rebuild = touched_nodes.count(node_gid) > 0 ||
+      !old_row_mapT->isNodeGlobalElement(getGlobalDOF(node_gid, 0));
+
+    for (std::size_t k=0; k < globalEqns.size(); ++k) {
+      const GO row = getGlobalDOF(node_gid, globalEqns[k]);
+      cols.clear();
+
+      if (rebuild) {
+        // Couple the row with all the nodes of the locally owned elements
+        // around this node, as the full path does.
+        getCoupledNodeGIDs(node, node_gids);
+        for (std::size_t l=0; l < node_gids.size(); l++)
+          for (std::size_t m=0; m < neq; m++)
+            cols.push_back(getGlobalDOF(node_gids[l], m));
+        ++num_rebuilt;
+      } else {
+        // Copy the previous row, dropping columns of nodes that are gone.
+        old_cols.resize(old_overlap_graphT->getNumEntriesInGlobalRow(row));
+        size_t num_copied_entries;
+        old_overlap_graphT->getGlobalRowCopy(row, old_cols(), num_copied_entries);
+        for (std::size_t l=0; l < num_copied_entries; l++)
+          if (overlap_node_mapT->isNodeGlobalElement(getGlobalNode(old_cols[l])))
+            cols.push_back(old_cols[l]);
+        ++num_copied;
+      }
+
+      if (cols.size() > 0)
+        overlap_graphT->insertGlobalIndices(row, cols());
+    }
+  }
+
+  if (commT->getRank()==0)
+    *out << "STKDisc: incremental graph update copied " << num_copied
+         << " rows and rebuilt " << num_rebuilt << " rows on Proc 0" << std::endl;
+}
+
+void Albany::STKDiscretization::recordGraphConnectivity()
+{
+  std::vector<std::pair<GO, stk::mesh::Entity> > sorted_cells(cells.size());
+  for (std::size_t i=0; i < cells.size(); i++)
+    sorted_cells[i] = std::make_pair(gid(cells[i]), cells[i]);
+  std::sort(sorted_cells.begin(), sorted_cells.end(),
+            [](const std::pair<GO, stk::mesh::Entity>& a, const std::pair<GO, stk::mesh::Entity>& b)
+            { return a.first < b.first; });
+
+  graphCellGIDs.resize(cells.size());
+  graphCellNodeOffsets.resize(cells.size() + 1);
+  graphCellNodeGIDs.clear();
+  graphCellNodeOffsets[0] = 0;
+  for (std::size_t i=0; i < sorted_cells.size(); i++) {
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(sorted_cells[i].second);
+    const size_t num_nodes = bulkData.num_nodes(sorted_cells[i].second);
+    graphCellGIDs[i] = sorted_cells[i].first;
+    for (std::size_t j=0; j < num_nodes; j++)
+      graphCellNodeGIDs.push_back(gid(node_rels[j]));
+    graphCellNodeOffsets[i+1] = graphCellNodeGIDs.size();
+  }
+}
+
+void Albany::STKDiscretization::getCoupledNodeGIDs(
+  stk::mesh::Entity node, std::vector<GO>& node_gids) const
+{
+  // Nodes of the locally owned elements around the node, sorted and unique.
+  node_gids.clear();
+  stk::mesh::Entity const* elems = bulkData.begin_elements(node);
+  const size_t num_elems = bulkData.num_elements(node);
+  for (std::size_t ie=0; ie < num_elems; ++ie) {
+    if (!bulkData.bucket(elems[ie]).owned()) continue;
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(elems[ie]);
+    const size_t num_nodes = bulkData.num_nodes(elems[ie]);
+    for (std::size_t l=0; l < num_nodes; l++)
+      node_gids.push_back(gid(node_rels[l]));
+  }
+  std::sort(node_gids.begin(), node_gids.end());
+  node_gids.erase(std::unique(node_gids.begin(), node_gids.end()), node_gids.end());
+}
+
+namespace {
+
+const char graph_cache_magic[8] = {'A','L','B','G','R','A','P','H'};
+const int graph_cache_version = 2;
+
+// FNV-1a
+void hashCombine(std::uint64_t& h, const void* data, const std::size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i < size; ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+}
+
+template<typename T>
+void hashCombine(std::uint64_t& h, const T& value)
+{
+  hashCombine(h, &value, sizeof(T));
+}
+
+template<typename T>
+bool readArray(std::istream& is, T* v, const std::size_t size)
+{
+  if (size > 0)
+    is.read(reinterpret_cast<char*>(v), size*sizeof(T));
+  return is.good();
+}
+
+template<typename T>
+void writeArray(std::ostream& os, const T* v, const std::size_t size)
+{
+  if (size > 0)
+    os.write(reinterpret_cast<const char*>(v), size*sizeof(T));
+}
+
+}
+
+std::uint64_t Albany::STKDiscretization::graphCacheKey() const
+{
+  std::uint64_t h = 14695981039346656037ULL;
+  hashCombine(h, commT->getSize());
+  hashCombine(h, commT->getRank());
+  hashCombine(h, neq);
+  hashCombine(h, interleavedOrdering);
+  hashCombine(h, static_cast<GO>(overlap_mapT->getMaxAllGlobalIndex()));
+
+  // The overlap map in local order defines the rows, the owned elements
+  // their columns
+  const Teuchos::ArrayView<const GO> rows = overlap_mapT->getNodeElementList();
+  if (rows.size() > 0)
+    hashCombine(h, rows.getRawPtr(), rows.size()*sizeof(GO));
+  for (std::size_t i=0; i < cells.size(); i++) {
+    hashCombine(h, gid(cells[i]));
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(cells[i]);
+    const size_t num_nodes = bulkData.num_nodes(cells[i]);
+    hashCombine(h, num_nodes);
+    for (std::size_t j=0; j < num_nodes; j++)
+      hashCombine(h, gid(node_rels[j]));
+  }
+  return h;
+}
+
+std::string Albany::STKDiscretization::graphCacheFileName() const
+{
+  std::ostringstream ss;
+  ss << stkMeshStruct->graphCacheFile << "." << commT->getSize() << "." << commT->getRank();
+  return ss.str();
+}
+
+bool Albany::STKDiscretization::readGraphCache()
+{
+  stk::mesh::Selector select_owned_in_part =
+    stk::mesh::Selector( metaData.universal_part() ) &
+    stk::mesh::Selector( metaData.locally_owned_part() );
+  stk::mesh::get_selected_entities( select_owned_in_part ,
+            bulkData.buckets( stk::topology::ELEMENT_RANK ) ,
+            cells );
+
+  // File layout: magic, version, sizeof(GO), sizeof(LO), key, number of
+  // rows, entries and columns, row offsets, local column indices, column
+  // map GIDs. The arrays are those of the fill-completed overlap graph, so
+  // the graph is built from them without sorting or merging.
+  std::ifstream is(graphCacheFileName().c_str(), std::ios::binary);
+  char magic[8];
+  int version = 0, go_size = 0, lo_size = 0;
+  std::uint64_t file_key = 0, num_rows = 0, num_entries = 0, num_cols = 0;
+  is.read(magic, sizeof(magic));
+  is.read(reinterpret_cast<char*>(&version), sizeof(version));
+  is.read(reinterpret_cast<char*>(&go_size), sizeof(go_size));
+  is.read(reinterpret_cast<char*>(&lo_size), sizeof(lo_size));
+  is.read(reinterpret_cast<char*>(&file_key), sizeof(file_key));
+  is.read(reinterpret_cast<char*>(&num_rows), sizeof(num_rows));
+  is.read(reinterpret_cast<char*>(&num_entries), sizeof(num_entries));
+  is.read(reinterpret_cast<char*>(&num_cols), sizeof(num_cols));
+  bool valid = is.good() && std::equal(magic, magic + sizeof(magic), graph_cache_magic) &&
+    version == graph_cache_version && go_size == sizeof(GO) && lo_size == sizeof(LO) &&
+    file_key == graphCacheKey() && num_rows == overlap_mapT->getNodeNumElements();
+
+  std::vector<std::uint64_t> offsets;
+  Teuchos::ArrayRCP<size_t> row_ptrs;
+  Teuchos::ArrayRCP<LO> col_indices;
+  Teuchos::Array<GO> col_gids;
+  if (valid) {
+    offsets.resize(num_rows + 1);
+    col_indices = Teuchos::arcp<LO>(num_entries);
+    col_gids.resize(num_cols);
+    valid = readArray(is, &offsets[0], num_rows + 1) &&
+      readArray(is, col_indices.getRawPtr(), num_entries) &&
+      readArray(is, col_gids.getRawPtr(), num_cols) &&
+      offsets[0] == 0 && offsets[num_rows] == num_entries;
+  }
+  if (valid) {
+    row_ptrs = Teuchos::arcp<size_t>(num_rows + 1);
+    row_ptrs[0] = 0;
+    for (std::size_t i=0; i < num_rows && valid; ++i) {
+      valid = offsets[i+1] >= offsets[i];
+      row_ptrs[i+1] = offsets[i+1];
+    }
+    for (std::size_t k=0; k < num_entries && valid; ++k)
+      valid = col_indices[k] >= 0 && static_cast<std::uint64_t>(col_indices[k]) < num_cols;
+  }
+
+  // The column map is built collectively, so either every rank uses its
+  // file or none does
+  int local_valid = valid ? 1 : 0, all_valid = 0;
+  Teuchos::reduceAll<int, int>(*commT, Teuchos::REDUCE_MIN, local_valid, Teuchos::outArg(all_valid));
+  if (all_valid == 0)
+    return false;
+
+  const Teuchos::RCP<const Tpetra_Map> col_mapT =
+    Tpetra::createNonContigMap<LO, GO>(col_gids(), commT);
+  overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, col_mapT, row_ptrs, col_indices));
+  overlap_graphT->expertStaticFillComplete(overlap_mapT, overlap_mapT);
+
+  if (stkMeshStruct->incrementalGraphUpdate)
+    recordGraphConnectivity();
+
+  if (commT->getRank()==0)
+    *out << "STKDisc: Jacobian graph read from " << graphCacheFileName() << std::endl;
+  return true;
+}
+
+void Albany::STKDiscretization::writeGraphCache() const
+{
+  const std::size_t num_rows = overlap_graphT->getNodeNumRows();
+  std::vector<std::uint64_t> offsets(1, 0);
+  std::vector<LO> col_indices;
+  col_indices.reserve(overlap_graphT->getNodeNumEntries());
+  Teuchos::ArrayView<const LO> row_indices;
+  for (std::size_t lrow=0; lrow < num_rows; ++lrow) {
+    overlap_graphT->getLocalRowView(lrow, row_indices);
+    col_indices.insert(col_indices.end(), row_indices.begin(), row_indices.end());
+    offsets.push_back(col_indices.size());
+  }
+  const Teuchos::ArrayView<const GO> col_gids = overlap_graphT->getColMap()->getNodeElementList();
+
+  // Write to a file of this process and move it in place, so that a run
+  // that crashes or runs concurrently never leaves a partial file under the
+  // name that later runs read
+  const std::string filename = graphCacheFileName();
+  std::ostringstream tmp;
+  tmp << filename << ".tmp." << getpid();
+  {
+    std::ofstream os(tmp.str().c_str(), std::ios::binary | std::ios::trunc);
+    const int version = graph_cache_version;
+    const int go_size = sizeof(GO), lo_size = sizeof(LO);
+    const std::uint64_t key = graphCacheKey();
+    const std::uint64_t num_rows_out = num_rows, num_entries = col_indices.size(),
+      num_cols = col_gids.size();
+    os.write(graph_cache_magic, sizeof(graph_cache_magic));
+    os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    os.write(reinterpret_cast<const char*>(&go_size), sizeof(go_size));
+    os.write(reinterpret_cast<const char*>(&lo_size), sizeof(lo_size));
+    os.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    os.write(reinterpret_cast<const char*>(&num_rows_out), sizeof(num_rows_out));
+    os.write(reinterpret_cast<const char*>(&num_entries), sizeof(num_entries));
+    os.write(reinterpret_cast<const char*>(&num_cols), sizeof(num_cols));
+    writeArray(os, &offsets[0], offsets.size());
+    writeArray(os, col_indices.data(), col_indices.size());
+    writeArray(os, col_gids.getRawPtr(), col_gids.size());
+    os.close();
+    if (!os) {
+      *out << "STKDisc: cannot write the Jacobian graph cache " << filename << std::endl;
+      std::remove(tmp.str().c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp.str().c_str(), filename.c_str()) != 0) {
+    *out << "STKDisc: cannot write the Jacobian graph cache " << filename << std::endl;
+    std::remove(tmp.str().c_str());
+  }
+}
+
 void Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
 {
 #ifdef ALBANY_PERIDIGM
@@ -1543,6 +2055,7 @@ void Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
 
 void Albany::STKDiscretization::computeWorksetInfo()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc workset info");
 
   stk::mesh::Selector select_owned_in_part =
     stk::mesh::Selector( metaData.universal_part() ) &
@@ -1798,6 +2311,11 @@ void Albany::STKDiscretization::computeWorksetInfo()
 //Kopy workset to the Kokkos data
  //wsElNodeEqID_kokkos=Kokkos::View<int****, PHX::Device>("wsElNodeEqID_kokkos",numBuckets,wsElNodeEqID[0].size(),wsElNodeEqID[0][0].size(), neq);
 
+  // Color the cells of each workset for the scatter, once per mesh
+  wsColoring.resize(numBuckets);
+  for (int b=0; b < numBuckets; b++)
+    wsColoring[b] = Albany::colorWorkset(wsElNodeID[b]);
+
 
  for (int d=0; d<stkMeshStruct->numDim; d++) {
   if (stkMeshStruct->PBCStruct.periodic[d]) {
@@ -1950,6 +2468,7 @@ void Albany::STKDiscretization::computeWorksetInfo()
 }
 
 void Albany::STKDiscretization::computeSideSets(){
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc side sets");
 
   // Clean up existing sideset structure if remeshing
 
@@ -2145,6 +2664,7 @@ Albany::STKDiscretization::determine_local_side_id( const stk::mesh::Entity elem
 
 void Albany::STKDiscretization::computeNodeSets()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc node sets");
 
   std::map<std::string, stk::mesh::Part*>::iterator ns = stkMeshStruct->nsPartVec.begin();
   AbstractSTKFieldContainer::VectorFieldType* coordinates_field = stkMeshStruct->getCoordinatesField();
@@ -2179,6 +2699,7 @@ void Albany::STKDiscretization::computeNodeSets()
 
 void Albany::STKDiscretization::setupExodusOutput()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc Exodus output setup");
 #ifdef ALBANY_SEACAS
   if (stkMeshStruct->exoOutput) {
 
@@ -2710,6 +3231,7 @@ void Albany::STKDiscretization::reNameExodusOutput(std::string& filename)
 // Convert the stk mesh on this processor to a nodal graph.
 //todo Dev/tested on linear elements only.
 void Albany::STKDiscretization::meshToGraph () {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: STKDisc nodal graph");
   if (Teuchos::is_null(stkMeshStruct->nodal_data_base)) return;
   if (!stkMeshStruct->nodal_data_base->isNodeDataPresent()) return;
 
@@ -2957,6 +3479,19 @@ void Albany::STKDiscretization::buildSideSetProjectors()
   }
 }
 
+void
+Albany::STKDiscretization::updateMeshAfterTopologyChange()
+{
+  incrementalGraphUpdate = stkMeshStruct->incrementalGraphUpdate;
+  try {
+    updateMesh();
+  } catch (...) {
+    incrementalGraphUpdate = false;
+    throw;
+  }
+  incrementalGraphUpdate = false;
+}
+
 void
 Albany::STKDiscretization::updateMesh(bool /*shouldTransferIPData*/)
 {
@@ -2975,6 +3510,8 @@ Albany::STKDiscretization::updateMesh(bool /*shouldTransferIPData*/)
     nodalDOFsStructContainer.addEmptyDOFsStruct(param_state.name, param_state.meshPart,numComps);
     }
 
+  computeNodeOrdering();
+
   computeNodalMaps(false);
 
 
@@ -10,6 +10,7 @@
 
 #include <vector>
 #include <utility>
+#include <cstdint>
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -172,6 +173,9 @@ namespace Albany {
     //! Get map from (Ws, Local Node) -> NodeGID
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type& getWsElNodeID() const;
 
+    //! Get the coloring of the cells of each workset (no two cells of a color share a node)
+    const Albany::WorksetArray<Albany::WorksetColoring>::type& getWsColoring() const;
+
     //! Get IDArray for (Ws, Local Node, nComps) -> (local) NodeLID, works for both scalar and vector fields
     const std::vector<IDArray>& getElNodeEqID(const std::string& field_name) const
         {return nodalDOFsStructContainer.getDOFsStruct(field_name).wsElNodeEqID;}
@@ -269,6 +273,12 @@ namespace Albany {
     //! After mesh modification, need to update the element connectivity and nodal coordinates
     void updateMesh(bool shouldTransferIPData = false);
 
+    //! Update after a local topology change (fracture, surface element
+    //! insertion). With the "Incremental Graph Update" option, the Jacobian
+    //! graph rows of nodes whose elements did not change are copied from the
+    //! previous graph instead of being rebuilt from the element connectivity.
+    void updateMeshAfterTopologyChange();
+
     //! Function that transforms an STK mesh of a unit cube (for FELIX problems)
     void transformMesh();
 
@@ -292,6 +302,8 @@ namespace Albany {
 
     //! Locate nodal dofs using global indexing
     GO getGlobalDOF(const GO inode, const int eq) const;
+    //! Node of a global DOF, the inverse of getGlobalDOF
+    GO getGlobalNode(const GO dof) const;
 
     Teuchos::RCP<LayeredMeshNumbering<LO> > getLayeredMeshNumbering() {return stkMeshStruct->layered_mesh_numbering;}
 
@@ -452,6 +464,9 @@ namespace Albany {
     //! Connectivity array [workset, element, local-node] => GID
     Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type wsElNodeID;
 
+    //! Coloring of the cells of each workset, recomputed with the worksets
+    Albany::WorksetArray<Albany::WorksetColoring>::type wsColoring;
+
     mutable Teuchos::ArrayRCP<double> coordinates;
     Teuchos::RCP<Tpetra_MultiVector> coordMV;
     Albany::WorksetArray<std::string>::type wsEBNames;
@@ -556,6 +571,46 @@ namespace Albany {
     void computeGraphsUpToFillComplete();
     void fillCompleteGraphs();
 
+    //! Build the owned graph by exporting the fill-completed overlap graph.
+    void computeOwnedGraph();
+
+    //! Hash of the local connectivity, unknown numbering and decomposition the overlap graph depends on.
+    std::uint64_t graphCacheKey() const;
+    //! Name of this rank's graph cache file.
+    std::string graphCacheFileName() const;
+    //! Build the fill-completed overlap graph from the cache files if they
+    //! match on every rank; true on success. Collective.
+    bool readGraphCache();
+    //! Write the local CSR arrays and column map of the overlap graph.
+    void writeGraphCache() const;
+
+    //! Global ids of the nodes of the locally owned elements around a node.
+    void getCoupledNodeGIDs(stk::mesh::Entity node, std::vector<GO>& node_gids) const;
+
+    //! Rebuild only the overlap graph rows of nodes whose elements changed.
+    void computeGraphsIncrementally(const Teuchos::RCP<const Tpetra_CrsGraph>& old_overlap_graphT,
+                                    const std::vector<int>& globalEqns);
+
+    //! Store the element connectivity the overlap graph was built from.
+    void recordGraphConnectivity();
+
+    //! Set by updateMeshAfterTopologyChange() for the duration of the update.
+    bool incrementalGraphUpdate;
+
+    //! Owned elements the current overlap graph was built from, sorted by
+    //! GID, and their node GIDs in CSR form. Only kept with the "Incremental
+    //! Graph Update" option.
+    std::vector<GO> graphCellGIDs;
+    std::vector<std::size_t> graphCellNodeOffsets;
+    std::vector<GO> graphCellNodeGIDs;
+
+    //! Compute nodeRank for the "Node Ordering" of the mesh struct.
+    void computeNodeOrdering();
+
+    //! Position of each owned or shared node (by GID) in the local numbering;
+    //! empty if nodes keep the STK bucket order.
+    std::map<GO, int> nodeRank;
+
   };
 
 }
@@ -13,10 +13,13 @@
 #include "Phalanx_MDField.hpp"
 
 #include "Albany_Layouts.hpp"
+#include "PHAL_GeometryCache.hpp"
 
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
 
+#include <type_traits>
+
 namespace PHAL {
 
 /** \brief Finite Element Interpolation Evaluator
@@ -43,6 +46,20 @@ private:
   typedef typename EvalT::MeshScalarT MeshScalarT;
   int  numVertices, numDims, numNodes, numQPs, numCells;
 
+  //! PHAL::GeometryCache id of the coordinates, cell, basis and cubature
+  int geometryLayout;
+
+  //! Copy the outputs from the PHAL::GeometryCache; false if not cached
+  bool loadGeometry(const GeometryCache::Key& key, std::true_type);
+  bool loadGeometry(const GeometryCache::Key& key, std::false_type) { return false; }
+
+  //! Store the outputs in the PHAL::GeometryCache
+  void storeGeometry(const GeometryCache::Key& key, std::true_type);
+  void storeGeometry(const GeometryCache::Key& key, std::false_type) {}
+
+  //! Only geometry without derivatives (MeshScalarT = RealType) is shared
+  typedef std::is_same<MeshScalarT, RealType> SharedGeometry;
+
   // Input:
   //! Coordinate vector at vertices
   PHX::MDField<MeshScalarT,Cell,Vertex,Dim> coordVec;
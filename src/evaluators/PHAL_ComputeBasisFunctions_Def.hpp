@@ -9,6 +9,9 @@
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
+#include <sstream>
+#include <typeinfo>
+
 namespace PHAL {
 template<typename EvalT, typename Traits>
 ComputeBasisFunctions<EvalT, Traits>::
@@ -47,6 +50,14 @@ ComputeBasisFunctions(const Teuchos::ParameterList& p,
   dl->vertices_vector->dimensions(dims);
   numVertices = dims[1];
 
+  // Evaluators of all evaluation types with the same inputs share entries
+  std::ostringstream layout;
+  layout << coordVec.fieldTag().name() << ":" << cellType->getName() << ":"
+         << typeid(*intrepidBasis).name() << ":" << intrepidBasis->getDegree() << ":"
+         << typeid(*cubature).name() << ":" << cubature->getNumPoints() << ":"
+         << numNodes << ":" << numQPs;
+  geometryLayout = GeometryCache::instance().layoutId(layout.str());
+
   this->setName("ComputeBasisFunctions"+PHX::typeAsString<EvalT>());
 }
 
@@ -95,6 +106,13 @@ evaluateFields(typename Traits::EvalData workset)
     */
 
 
+  // The geometry of a fixed mesh is the same for all evaluation types and iterations
+  const GeometryCache::Key key = { workset.disc.get(), geometryLayout, workset.wsIndex };
+  if (loadGeometry(key, SharedGeometry())) {
+    Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE(BF.get_view(), val_at_cub_points);
+    return;
+  }
+
   typedef typename Intrepid2::CellTools<PHX::Device>   ICT;
   typedef Intrepid2::FunctionSpaceTools<PHX::Device>   IFST;
 
@@ -108,6 +126,66 @@ evaluateFields(typename Traits::EvalData workset)
   IFST::multiplyMeasure    (wBF.get_view(), weighted_measure.get_view(), BF.get_view());
   IFST::HGRADtransformGRAD (GradBF.get_view(), jacobian_inv, grad_at_cub_points);
   IFST::multiplyMeasure    (wGradBF.get_view(), weighted_measure.get_view(), GradBF.get_view());
+
+  storeGeometry(key, SharedGeometry());
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool ComputeBasisFunctions<EvalT, Traits>::
+loadGeometry(const GeometryCache::Key& key, std::true_type)
+{
+  GeometryCache& cache = GeometryCache::instance();
+  if (!cache.enabled(key.disc)) return false;
+
+  const GeometryCache::Entry* entry = cache.find(key);
+  if (entry == NULL) return false;
+
+  // Recompute if the cells have moved since the entry was stored
+  for (int cell=0; cell < numCells; ++cell)
+    for (int v=0; v < numVertices; ++v)
+      for (int dim=0; dim < numDims; ++dim)
+        if (coordVec(cell,v,dim) != entry->coords(cell,v,dim)) return false;
+
+  Kokkos::deep_copy(weighted_measure.get_view(), entry->fields[0]);
+  Kokkos::deep_copy(jacobian_det.get_view(), entry->fields[1]);
+  Kokkos::deep_copy(wBF.get_view(), entry->fields[2]);
+  Kokkos::deep_copy(GradBF.get_view(), entry->fields[3]);
+  Kokkos::deep_copy(wGradBF.get_view(), entry->fields[4]);
+  return true;
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctions<EvalT, Traits>::
+storeGeometry(const GeometryCache::Key& key, std::true_type)
+{
+  GeometryCache& cache = GeometryCache::instance();
+  if (!cache.enabled(key.disc)) return;
+
+  // A stale entry of this workset has the right sizes; overwrite its views
+  typedef GeometryCache::View View;
+  const GeometryCache::Entry* stale = cache.find(key);
+  GeometryCache::Entry entry;
+  if (stale != NULL) {
+    entry = *stale;
+  } else {
+    entry.coords = View("Coord Vec", numCells, numVertices, numDims);
+    entry.fields.push_back(View("Weights", numCells, numQPs));
+    entry.fields.push_back(View("Jacobian Det", numCells, numQPs));
+    entry.fields.push_back(View("wBF", numCells, numNodes, numQPs));
+    entry.fields.push_back(View("Grad BF", numCells, numNodes, numQPs, numDims));
+    entry.fields.push_back(View("wGrad BF", numCells, numNodes, numQPs, numDims));
+  }
+
+  Kokkos::deep_copy(entry.coords, coordVec.get_view());
+  Kokkos::deep_copy(entry.fields[0], weighted_measure.get_view());
+  Kokkos::deep_copy(entry.fields[1], jacobian_det.get_view());
+  Kokkos::deep_copy(entry.fields[2], wBF.get_view());
+  Kokkos::deep_copy(entry.fields[3], GradBF.get_view());
+  Kokkos::deep_copy(entry.fields[4], wGradBF.get_view());
+
+  cache.insert(key, entry);
 }
 
 //**********************************************************************
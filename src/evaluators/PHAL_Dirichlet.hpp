@@ -21,6 +21,7 @@
 
 #include "Sacado_ParameterAccessor.hpp"
 #include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_DirichletRowEliminator.hpp"
 
 namespace PHAL {
 /** \brief Gathers solution values from the Newton solution vector into
@@ -82,6 +83,11 @@ class Dirichlet<PHAL::AlbanyTraits::Residual,Traits>
 public:
   Dirichlet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
+private:
+  //! Lift the columns the Jacobian fill eliminates.
+  const bool symmetric;
+  Teuchos::RCP<DirichletRowEliminator> eliminator;
+  std::vector<ST> bcValues;
 };
 
 // **************************************************************
@@ -93,6 +99,12 @@ class Dirichlet<PHAL::AlbanyTraits::Jacobian,Traits>
 public:
   Dirichlet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
+private:
+  //! Also zero the constrained columns to keep a symmetric Jacobian symmetric.
+  const bool symmetric;
+  //! Shared with the Residual evaluator of this condition
+  Teuchos::RCP<DirichletRowEliminator> eliminator;
+  std::vector<ST> bcValues;
 };
 
 // **************************************************************
@@ -173,6 +185,9 @@ class Dirichlet<PHAL::AlbanyTraits::MPJacobian,Traits>
 public:
   Dirichlet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
+private:
+  //! Used by the Tpetra fill
+  DirichletRowEliminator eliminator;
 };
 
 // **************************************************************
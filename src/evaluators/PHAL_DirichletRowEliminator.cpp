@@ -0,0 +1,249 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+
+#include "Teuchos_TestForException.hpp"
+
+#include "PHAL_DirichletRowEliminator.hpp"
+
+namespace {
+
+typedef Tpetra_CrsMatrix::local_matrix_type LocalMatrix;
+typedef LocalMatrix::device_type DeviceType;
+typedef LocalMatrix::execution_space ExecutionSpace;
+
+//! Replaces row rows(i) by diag times the identity row
+struct ZeroRows {
+  LocalMatrix matrix;
+  Kokkos::View<LO*, DeviceType> rows;
+  Kokkos::View<long*, DeviceType> diag_pos;
+  ST diag;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int i) const {
+    const LO row = rows(i);
+    for (std::size_t k = matrix.graph.row_map(row); k < matrix.graph.row_map(row+1); ++k)
+      matrix.values(k) = 0;
+    if (diag_pos(i) >= 0)
+      matrix.values(diag_pos(i)) = diag;
+  }
+};
+
+//! Zeroes the entries at col_pos and keeps them, scaled, in col_coef
+struct ZeroColumns {
+  LocalMatrix matrix;
+  Kokkos::View<std::size_t*, DeviceType> col_pos;
+  Kokkos::View<ST*, DeviceType> col_coef;
+  ST scale;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int i) const {
+    col_coef(i) = scale * matrix.values(col_pos(i));
+    matrix.values(col_pos(i)) = 0;
+  }
+};
+
+template<typename T>
+Kokkos::View<T*, DeviceType>
+toDevice (const std::vector<T>& v, const char* name)
+{
+  Kokkos::View<T*, DeviceType> v_d(name, v.size());
+  const typename Kokkos::View<T*, DeviceType>::HostMirror v_h = Kokkos::create_mirror_view(v_d);
+  for (std::size_t i = 0; i < v.size(); ++i)
+    v_h(i) = v[i];
+  Kokkos::deep_copy(v_d, v_h);
+  return v_d;
+}
+
+//! Local comparison; Tpetra::Map::isSameAs is collective
+bool sameLocalMap (const Tpetra_Map& a, const Tpetra_Map& b)
+{
+  if (&a == &b) return true;
+  if (a.getNodeNumElements() != b.getNodeNumElements()) return false;
+  const Teuchos::ArrayView<const GO> a_gids = a.getNodeElementList();
+  const Teuchos::ArrayView<const GO> b_gids = b.getNodeElementList();
+  return std::equal(a_gids.begin(), a_gids.end(), b_gids.begin());
+}
+
+} // namespace
+
+namespace PHAL {
+
+DirichletRowEliminator::DirichletRowEliminator ()
+  : numNodes_(0), offset_(-1), static_graph_(false),
+    have_columns_(false), have_coefficients_(false)
+{}
+
+void DirichletRowEliminator::
+update (const Tpetra_CrsMatrix& jac,
+        const std::vector<std::vector<int> >& nsNodes,
+        const int offset, const bool symmetric)
+{
+  const Teuchos::RCP<const Tpetra_CrsGraph> graph = jac.getCrsGraph();
+  const bool same = graph.get() == graph_.get() && nsNodes.size() == numNodes_ &&
+    offset == offset_;
+
+  if (!same) {
+    graph_ = graph;
+    numNodes_ = nsNodes.size();
+    offset_ = offset;
+    static_graph_ = jac.isStaticGraph();
+    have_columns_ = false;
+    have_coefficients_ = false;
+
+    rows_.resize(numNodes_);
+    for (std::size_t inode = 0; inode < numNodes_; ++inode)
+      rows_[inode] = nsNodes[inode][offset];
+
+    std::vector<long> diag_pos(numNodes_, -1);
+    if (static_graph_) {
+      // Searched on the host, once per graph
+      const Tpetra_CrsGraph::local_graph_type lclGraph = graph->getLocalGraph();
+      const Tpetra_CrsGraph::local_graph_type::row_map_type::HostMirror row_map =
+        Kokkos::create_mirror_view(lclGraph.row_map);
+      const Tpetra_CrsGraph::local_graph_type::entries_type::HostMirror entries =
+        Kokkos::create_mirror_view(lclGraph.entries);
+      Kokkos::deep_copy(row_map, lclGraph.row_map);
+      Kokkos::deep_copy(entries, lclGraph.entries);
+
+      const Teuchos::RCP<const Tpetra_Map> rowMap = graph->getRowMap();
+      const Teuchos::RCP<const Tpetra_Map> colMap = graph->getColMap();
+      for (std::size_t i = 0; i < numNodes_; ++i) {
+        const LO row = rows_[i];
+        const LO diag_col = colMap->getLocalElement(rowMap->getGlobalElement(row));
+        for (std::size_t k = row_map(row); k < row_map(row+1); ++k)
+          if (entries(k) == diag_col) {
+            diag_pos[i] = k;
+            break;
+          }
+      }
+    }
+    rows_d_ = toDevice(rows_, "Dirichlet rows");
+    diag_pos_d_ = toDevice(diag_pos, "Dirichlet diagonal positions");
+  }
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    symmetric && !static_graph_, std::logic_error,
+    "Error! Symmetric Dirichlet elimination requires a Jacobian with a static graph.\n");
+
+  if (symmetric && !have_columns_)
+    buildColumns(jac);
+}
+
+void DirichletRowEliminator::
+eliminateRows (Tpetra_CrsMatrix& jac, const ST diag) const
+{
+  if (static_graph_) {
+    const ZeroRows zero = { jac.getLocalMatrix(), rows_d_, diag_pos_d_, diag };
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, rows_.size()), zero);
+    return;
+  }
+
+  // Dynamic graph: the local matrix is not valid during fill.
+  Teuchos::Array<LO> index(1);
+  Teuchos::Array<ST> value(1, diag);
+  Teuchos::Array<ST> matrixEntriesT;
+  Teuchos::Array<LO> matrixIndicesT;
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    const LO row = rows_[i];
+    size_t numEntriesT = jac.getNumEntriesInLocalRow(row);
+    matrixEntriesT.resize(numEntriesT);
+    matrixIndicesT.resize(numEntriesT);
+    jac.getLocalRowCopy(row, matrixIndicesT(), matrixEntriesT(), numEntriesT);
+    for (size_t j = 0; j < numEntriesT; ++j) matrixEntriesT[j] = 0;
+    jac.replaceLocalValues(row, matrixIndicesT(), matrixEntriesT());
+    index[0] = row;
+    jac.replaceLocalValues(row, index(), value());
+  }
+}
+
+void DirichletRowEliminator::
+buildColumns (const Tpetra_CrsMatrix& jac)
+{
+  const Teuchos::RCP<const Tpetra_Map> rowMap = graph_->getRowMap();
+  const Teuchos::RCP<const Tpetra_Map> colMap = graph_->getColMap();
+  col_importer_ = Teuchos::rcp(new Tpetra_Import(rowMap, colMap));
+
+  // Mark the constrained unknowns and bring the marks to the column map, so
+  // that columns owned by other processes are found too.
+  Tpetra_Vector rowFlag(rowMap), colFlag(colMap);
+  {
+    Teuchos::ArrayRCP<ST> rowFlag_nonconstView = rowFlag.get1dViewNonConst();
+    for (std::size_t i = 0; i < rows_.size(); ++i)
+      rowFlag_nonconstView[rows_[i]] = 1.0;
+  }
+  colFlag.doImport(rowFlag, *col_importer_, Tpetra::INSERT);
+
+  Teuchos::ArrayRCP<const ST> rowFlag_constView = rowFlag.get1dView();
+  Teuchos::ArrayRCP<const ST> colFlag_constView = colFlag.get1dView();
+  const Tpetra_CrsGraph::local_graph_type lclGraph = graph_->getLocalGraph();
+  const Tpetra_CrsGraph::local_graph_type::row_map_type::HostMirror row_map =
+    Kokkos::create_mirror_view(lclGraph.row_map);
+  const Tpetra_CrsGraph::local_graph_type::entries_type::HostMirror entries =
+    Kokkos::create_mirror_view(lclGraph.entries);
+  Kokkos::deep_copy(row_map, lclGraph.row_map);
+  Kokkos::deep_copy(entries, lclGraph.entries);
+  const LO numRows = static_cast<LO>(rowMap->getNodeNumElements());
+
+  std::vector<std::size_t> col_pos;
+  col_row_.clear();
+  col_col_.clear();
+  for (LO row = 0; row < numRows; ++row) {
+    if (rowFlag_constView[row] != 0.0) continue;
+    for (std::size_t k = row_map(row); k < row_map(row+1); ++k) {
+      const LO col = entries(k);
+      if (colFlag_constView[col] != 0.0) {
+        col_pos.push_back(k);
+        col_row_.push_back(row);
+        col_col_.push_back(col);
+      }
+    }
+  }
+  col_pos_d_ = toDevice(col_pos, "Dirichlet column positions");
+  col_coef_d_ = Kokkos::View<ST*, DeviceType>("Dirichlet lifting coefficients", col_pos.size());
+  col_coef_h_ = Kokkos::create_mirror_view(col_coef_d_);
+  have_columns_ = true;
+  have_coefficients_ = false;
+}
+
+void DirichletRowEliminator::
+eliminateColumns (Tpetra_CrsMatrix& jac, const ST j_coeff)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    !have_columns_, std::logic_error,
+    "Error! DirichletRowEliminator::update was not called with symmetric = true.\n");
+
+  const ZeroColumns zero = { jac.getLocalMatrix(), col_pos_d_, col_coef_d_, 1.0 / j_coeff };
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, col_pos_d_.dimension_0()), zero);
+  Kokkos::deep_copy(col_coef_h_, col_coef_d_);
+  have_coefficients_ = true;
+}
+
+void DirichletRowEliminator::
+liftResidual (const std::vector<ST>& bcValues, Tpetra_Vector& fT) const
+{
+  if (!have_coefficients_) return;
+
+  // Coefficients of an older graph do not apply
+  const Teuchos::RCP<const Tpetra_Map> rowMap = graph_->getRowMap();
+  if (!sameLocalMap(*fT.getMap(), *rowMap)) return;
+
+  Tpetra_Vector rowBC(rowMap), colBC(graph_->getColMap());
+  {
+    Teuchos::ArrayRCP<ST> rowBC_nonconstView = rowBC.get1dViewNonConst();
+    for (std::size_t i = 0; i < rows_.size(); ++i)
+      rowBC_nonconstView[rows_[i]] = bcValues[i];
+  }
+  colBC.doImport(rowBC, *col_importer_, Tpetra::INSERT);
+
+  Teuchos::ArrayRCP<const ST> colBC_constView = colBC.get1dView();
+  Teuchos::ArrayRCP<ST> fT_nonconstView = fT.get1dViewNonConst();
+  for (std::size_t i = 0; i < col_row_.size(); ++i)
+    fT_nonconstView[col_row_[i]] -= col_coef_h_(i) * colBC_constView[col_col_[i]];
+}
+
+} // namespace PHAL
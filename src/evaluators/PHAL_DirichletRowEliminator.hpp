@@ -0,0 +1,93 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_DIRICHLET_ROW_ELIMINATOR_HPP
+#define PHAL_DIRICHLET_ROW_ELIMINATOR_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+namespace PHAL {
+
+/*! \brief Applies a Dirichlet condition to the rows of a Tpetra_CrsMatrix.
+ *
+ *  The constrained local rows, the position of their diagonal entry in the
+ *  local CRS value array and, for symmetric elimination, the positions of the
+ *  constrained columns are computed once per Jacobian graph and node set. The
+ *  rows and columns are then zeroed in place by kernels on the local matrix,
+ *  with no per-row copies or lookups.
+ *
+ *  If the matrix does not have a static graph, the eliminator falls back to
+ *  getLocalRowCopy/replaceLocalValues.
+ *
+ *  The Residual and Jacobian evaluators of one condition share an eliminator,
+ *  so that residual-only fills lift the eliminated columns like Jacobian
+ *  fills do.
+ */
+class DirichletRowEliminator {
+public:
+  DirichletRowEliminator();
+
+  //! Recompute the cached rows if the graph of \c jac or the node set changed.
+  void update(const Tpetra_CrsMatrix& jac,
+              const std::vector<std::vector<int> >& nsNodes,
+              const int offset, const bool symmetric);
+
+  //! Local rows constrained by this node set and offset.
+  const std::vector<LO>& rows () const { return rows_; }
+
+  //! Replace each constrained row by \c diag times the identity row.
+  void eliminateRows(Tpetra_CrsMatrix& jac, const ST diag) const;
+
+  /*! \brief Zero the constrained columns in all other rows.
+   *
+   *  The eliminated entries, divided by \c j_coeff, are kept as the lifting
+   *  coefficients of liftResidual().
+   */
+  void eliminateColumns(Tpetra_CrsMatrix& jac, const ST j_coeff);
+
+  /*! \brief Move the eliminated columns to the right-hand side.
+   *
+   *  The Dirichlet row of the Newton system is j_coeff dx_i = -(x_i - g), so
+   *  an eliminated entry A_ri adds A_ri (x_i - g) / j_coeff to row r of the
+   *  residual. \c bcValues holds x - g for each entry of rows(). Residual
+   *  and Jacobian fills use the coefficients of the last Jacobian fill on the
+   *  same graph; before the first one, and once x = g, there is nothing to
+   *  lift.
+   */
+  void liftResidual(const std::vector<ST>& bcValues, Tpetra_Vector& fT) const;
+
+private:
+  typedef Tpetra_CrsMatrix::local_matrix_type::device_type DeviceType;
+
+  void buildColumns(const Tpetra_CrsMatrix& jac);
+
+  Teuchos::RCP<const Tpetra_CrsGraph> graph_;
+  std::size_t numNodes_;
+  int offset_;
+  bool static_graph_;
+
+  std::vector<LO> rows_;
+  Kokkos::View<LO*, DeviceType> rows_d_;
+  //! Position of the diagonal of each row in the local value array; -1 if
+  //! the graph does not contain it.
+  Kokkos::View<long*, DeviceType> diag_pos_d_;
+
+  //! Symmetric elimination: value position, row and column of each entry in
+  //! an unconstrained row lying in a constrained column, and its lifting
+  //! coefficient from the last Jacobian fill.
+  bool have_columns_, have_coefficients_;
+  Kokkos::View<std::size_t*, DeviceType> col_pos_d_;
+  Kokkos::View<ST*, DeviceType> col_coef_d_;
+  Kokkos::View<ST*, DeviceType>::HostMirror col_coef_h_;
+  std::vector<LO> col_row_, col_col_;
+  Teuchos::RCP<const Tpetra_Import> col_importer_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_DIRICHLET_ROW_ELIMINATOR_HPP
@@ -17,6 +17,17 @@
 
 namespace PHAL {
 
+namespace {
+//! The eliminator shared by the evaluators of one condition, if any
+inline Teuchos::RCP<DirichletRowEliminator>
+rowEliminator(const Teuchos::ParameterList& p)
+{
+  typedef Teuchos::RCP<DirichletRowEliminator> Ptr;
+  return p.isType<Ptr>("Row Eliminator") ? p.get<Ptr>("Row Eliminator") :
+    Teuchos::rcp(new DirichletRowEliminator);
+}
+}
+
 template<typename EvalT,typename Traits>
 DirichletBase<EvalT, Traits>::
 DirichletBase(Teuchos::ParameterList& p) :
@@ -67,7 +78,9 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename Traits>
 Dirichlet<PHAL::AlbanyTraits::Residual, Traits>::
 Dirichlet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::Residual, Traits>(p)
+  DirichletBase<PHAL::AlbanyTraits::Residual, Traits>(p),
+  symmetric(p.get<bool>("Symmetric Elimination", false)),
+  eliminator(rowEliminator(p))
 {
 }
 
@@ -85,6 +98,14 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   // Grab the vector off node GIDs for this Node Set ID from the std::map
   const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
+  // Same right-hand side as a Jacobian fill with symmetric elimination
+  if (symmetric) {
+    bcValues.resize(nsNodes.size());
+    for (std::size_t inode = 0; inode < nsNodes.size(); ++inode)
+      bcValues[inode] = xT_constView[nsNodes[inode][this->offset]] - this->value;
+    eliminator->liftResidual(bcValues, *fT);
+  }
+
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
       int lunk = nsNodes[inode][this->offset];
       // (*f)[lunk] = ((*x)[lunk] - this->value);
@@ -98,7 +119,9 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 template<typename Traits>
 Dirichlet<PHAL::AlbanyTraits::Jacobian, Traits>::
 Dirichlet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::Jacobian, Traits>(p)
+  DirichletBase<PHAL::AlbanyTraits::Jacobian, Traits>(p),
+  symmetric(p.get<bool>("Symmetric Elimination", false)),
+  eliminator(rowEliminator(p))
 {
 }
 
@@ -117,32 +140,32 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
+  // Constrained rows and their diagonal positions are only recomputed when
+  // the Jacobian graph changes.
+  eliminator->update(*jacT, nsNodes, this->offset, symmetric);
+  const std::vector<LO>& rows = eliminator->rows();
+
   bool fillResid = (fT != Teuchos::null);
   Teuchos::ArrayRCP<ST> fT_nonconstView;
-  if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
-
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1);
-  size_t numEntriesT;
-  value[0] = j_coeff;
-  Teuchos::Array<ST> matrixEntriesT;
-  Teuchos::Array<LO> matrixIndicesT;
 
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
-      index[0] = lunk;
-      numEntriesT = jacT->getNumEntriesInLocalRow(lunk);
-      matrixEntriesT.resize(numEntriesT);
-      matrixIndicesT.resize(numEntriesT);
+  // The lifting coefficients are kept for the residual-only fills
+  if (symmetric) {
+    eliminator->eliminateColumns(*jacT, j_coeff);
+    if (fillResid) {
+      bcValues.resize(rows.size());
+      for (std::size_t i = 0; i < rows.size(); ++i)
+        bcValues[i] = xT_constView[rows[i]] - this->value.val();
+      eliminator->liftResidual(bcValues, *fT);
+    }
+  }
 
-      jacT->getLocalRowCopy(lunk, matrixIndicesT(), matrixEntriesT(), numEntriesT);
-      for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-      jacT->replaceLocalValues(lunk, matrixIndicesT(), matrixEntriesT());
+  eliminator->eliminateRows(*jacT, j_coeff);
 
-      jacT->replaceLocalValues(lunk, index(), value());
+  if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
-      if (fillResid) fT_nonconstView[lunk] = xT_constView[lunk] - this->value.val();
-  }
+  if (fillResid)
+    for (std::size_t i = 0; i < rows.size(); ++i)
+      fT_nonconstView[rows[i]] = xT_constView[rows[i]] - this->value.val();
 }
 
 // **********************************************************************
@@ -416,6 +439,21 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   const std::vector<std::vector<int> >& nsNodes =
     dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
+  // Tpetra fill: column block of mp_fT and mp_xT is ensemble member block
+  if (Teuchos::nonnull(dirichletWorkset.mp_fT)) {
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT =
+      dirichletWorkset.mp_fT->get2dViewNonConst();
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT =
+      dirichletWorkset.mp_xT->get2dView();
+    int nblock = xT.size();
+    for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+      int lunk = nsNodes[inode][this->offset];
+      for (int block=0; block<nblock; block++)
+        fT[block][lunk] = xT[block][lunk] - this->value.coeff(block);
+    }
+    return;
+  }
+
   int nblock = x->size();
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
       int lunk = nsNodes[inode][this->offset];
@@ -450,6 +488,30 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   const std::vector<std::vector<int> >& nsNodes =
     dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
+  // Tpetra fill: the members' Jacobians share a graph, so the constrained
+  // rows are located once for all of them
+  if (Teuchos::nonnull(dirichletWorkset.mp_JacT)) {
+    const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& jacT =
+      *dirichletWorkset.mp_JacT;
+    if (jacT.size() == 0) return;
+    eliminator.update(*jacT[0], nsNodes, this->offset, false);
+    for (int block=0; block<jacT.size(); block++)
+      eliminator.eliminateRows(*jacT[block], j_coeff);
+
+    if (Teuchos::nonnull(dirichletWorkset.mp_fT)) {
+      Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT =
+        dirichletWorkset.mp_fT->get2dViewNonConst();
+      Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT =
+        dirichletWorkset.mp_xT->get2dView();
+      const std::vector<LO>& rows = eliminator.rows();
+      for (int block=0; block<fT.size(); block++)
+        for (std::size_t i = 0; i < rows.size(); ++i)
+          fT[block][rows[i]] =
+            xT[block][rows[i]] - this->value.val().coeff(block);
+    }
+    return;
+  }
+
   RealType* matrixEntries;
   int*    matrixIndices;
   int     numEntries;
@@ -1323,9 +1323,18 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::RCP<const Stokhos::ProductEpetraVector > xdotdot =
     workset.mp_xdotdot;
 
+  // Tpetra fill: column block of mp_xT is ensemble member block
+  const bool tpetra = Teuchos::nonnull(workset.mp_xT);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT, xdotT, xdotdotT;
+  if (tpetra) {
+    xT = workset.mp_xT->get2dView();
+    if (Teuchos::nonnull(workset.mp_xdotT)) xdotT = workset.mp_xdotT->get2dView();
+    if (Teuchos::nonnull(workset.mp_xdotdotT)) xdotdotT = workset.mp_xdotdotT->get2dView();
+  }
+
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
-  int nblock = x->size();
+  int nblock = tpetra ? xT.size() : x->size();
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
 
@@ -1339,7 +1348,8 @@ evaluateFields(typename Traits::EvalData workset)
         valref.copyForWrite();
         for (int block=0; block<nblock; block++)
           valref.fastAccessCoeff(block) =
-            (*x)[block][nodeID[node][this->offset + eq]];
+            (tpetra ? xT[block][nodeID[node][this->offset + eq]] :
+                      (*x)[block][nodeID[node][this->offset + eq]]);
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1351,7 +1361,8 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdot)[block][nodeID[node][this->offset + eq]];
+              (tpetra ? xdotT[block][nodeID[node][this->offset + eq]] :
+                        (*xdot)[block][nodeID[node][this->offset + eq]]);
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1364,7 +1375,8 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdotdot)[block][nodeID[node][this->offset + eq]];
+              (tpetra ? xdotdotT[block][nodeID[node][this->offset + eq]] :
+                        (*xdotdot)[block][nodeID[node][this->offset + eq]]);
         }
       }
     }
@@ -1407,9 +1419,18 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::RCP<const Stokhos::ProductEpetraVector > xdotdot =
     workset.mp_xdotdot;
 
+  // Tpetra fill: column block of mp_xT is ensemble member block
+  const bool tpetra = Teuchos::nonnull(workset.mp_xT);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT, xdotT, xdotdotT;
+  if (tpetra) {
+    xT = workset.mp_xT->get2dView();
+    if (Teuchos::nonnull(workset.mp_xdotT)) xdotT = workset.mp_xdotT->get2dView();
+    if (Teuchos::nonnull(workset.mp_xdotdotT)) xdotdotT = workset.mp_xdotdotT->get2dView();
+  }
+
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
-  int nblock = x->size();
+  int nblock = tpetra ? xT.size() : x->size();
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
 
@@ -1428,7 +1449,9 @@ evaluateFields(typename Traits::EvalData workset)
         valref.val().reset(nblock);
         valref.val().copyForWrite();
         for (int block=0; block<nblock; block++)
-          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID[node][this->offset + eq]];
+          valref.val().fastAccessCoeff(block) =
+            (tpetra ? xT[block][nodeID[node][this->offset + eq]] :
+                      (*x)[block][nodeID[node][this->offset + eq]]);
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1441,7 +1464,9 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) =
+              (tpetra ? xdotT[block][nodeID[node][this->offset + eq]] :
+                        (*xdot)[block][nodeID[node][this->offset + eq]]);
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1455,7 +1480,9 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) =
+              (tpetra ? xdotdotT[block][nodeID[node][this->offset + eq]] :
+                        (*xdotdot)[block][nodeID[node][this->offset + eq]]);
         }
       }
     }
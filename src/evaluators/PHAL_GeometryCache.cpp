@@ -0,0 +1,98 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_GeometryCache.hpp"
+
+namespace PHAL {
+
+GeometryCache GeometryCache::instance_ = GeometryCache();
+
+GeometryCache& GeometryCache::instance () {
+  // Static object lifetime
+  return instance_;
+}
+
+GeometryCache::GeometryCache () :
+  bytes_(0)
+{}
+
+void GeometryCache::setMemoryBudget (const void* disc, const double megabytes) {
+  clear(disc);
+  if (megabytes > 0) {
+    const Usage usage = { static_cast<std::size_t>(megabytes * (1 << 20)), 0 };
+    budgets_[disc] = usage;
+  }
+}
+
+int GeometryCache::layoutId (const std::string& layout) {
+  const std::map<std::string, int>::const_iterator it = layouts_.find(layout);
+  if (it != layouts_.end()) return it->second;
+  const int id = layouts_.size();
+  layouts_[layout] = id;
+  return id;
+}
+
+const GeometryCache::Entry* GeometryCache::find (const Key& key) const {
+  const std::map<Key, Entry>::const_iterator it = entries_.find(key);
+  return it == entries_.end() ? NULL : &it->second;
+}
+
+bool GeometryCache::insert (const Key& key, const Entry& entry) {
+  const std::map<const void*, Usage>::iterator usage = budgets_.find(key.disc);
+  if (usage == budgets_.end()) return false;
+
+  const std::map<Key, Entry>::iterator it = entries_.find(key);
+  const std::size_t previous = it == entries_.end() ? 0 : size(it->second);
+  const std::size_t needed = size(entry);
+  if (usage->second.bytes - previous + needed > usage->second.budget) {
+    // The old entry is stale, don't let it hold on to the budget
+    if (it != entries_.end()) {
+      entries_.erase(it);
+      usage->second.bytes -= previous;
+      bytes_ -= previous;
+    }
+    return false;
+  }
+
+  entries_[key] = entry;
+  usage->second.bytes = usage->second.bytes - previous + needed;
+  bytes_ = bytes_ - previous + needed;
+  return true;
+}
+
+void GeometryCache::clear () {
+  entries_.clear();
+  for (std::map<const void*, Usage>::iterator it = budgets_.begin(); it != budgets_.end(); ++it)
+    it->second.bytes = 0;
+  bytes_ = 0;
+}
+
+void GeometryCache::clear (const void* disc) {
+  std::map<Key, Entry>::iterator it = entries_.begin();
+  while (it != entries_.end()) {
+    if (it->first.disc == disc) {
+      bytes_ -= size(it->second);
+      entries_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  budgets_.erase(disc);
+}
+
+std::size_t GeometryCache::bytes (const void* disc) const {
+  const std::map<const void*, Usage>::const_iterator it = budgets_.find(disc);
+  return it == budgets_.end() ? 0 : it->second.bytes;
+}
+
+std::size_t GeometryCache::size (const Entry& entry) {
+  std::size_t n = entry.coords.span();
+  for (std::size_t i = 0; i < entry.fields.size(); ++i)
+    n += entry.fields[i].span();
+  return n * sizeof(RealType);
+}
+
+} // namespace PHAL
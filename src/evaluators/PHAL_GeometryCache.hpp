@@ -0,0 +1,116 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_GEOMETRY_CACHE_HPP
+#define PHAL_GEOMETRY_CACHE_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "PHAL_AlbanyTraits.hpp"
+
+namespace PHAL {
+
+/*! \brief Element geometry of the worksets, shared by all evaluation types.
+ *
+ *  With a fixed mesh the Jacobians, measures and weighted basis functions
+ *  of a workset are the same for the Residual, Jacobian, Tangent and
+ *  DistParamDeriv fills and for every Newton iteration. Evaluators that
+ *  compute them from RealType coordinates can store them here once and copy
+ *  them back on later evaluations. An entry is only valid for the
+ *  coordinates it was computed from, which are stored with it, so mesh
+ *  motion and adaptation invalidate it.
+ *
+ *  Entries are keyed by the discretization, the workset and a layout id
+ *  that the evaluator registers once for its coordinate field, cell type,
+ *  basis and cubature, so evaluators with different inputs on the same
+ *  workset do not share or evict each other's entries.
+ *
+ *  The cache is off by default. The "Geometry Cache Memory Budget" of the
+ *  Problem list (in MB) turns it on for the discretization of that problem
+ *  and bounds the memory of its entries; worksets that do not fit are
+ *  recomputed on every evaluation. Each discretization has its own budget,
+ *  so the applications of a coupled run (e.g. Schwarz) do not replace each
+ *  other's budget or drop each other's entries. The entries and budget of
+ *  a discretization hold device views and have to be dropped with
+ *  clear(disc) before the discretization, and Kokkos, go away.
+ */
+class GeometryCache {
+public:
+
+  typedef Kokkos::DynRankView<RealType, PHX::Device> View;
+
+  struct Entry {
+    View coords;
+    std::vector<View> fields;
+  };
+
+  struct Key {
+    const void* disc;
+    int layout;
+    unsigned int wsIndex;
+
+    bool operator< (const Key& other) const {
+      if (disc != other.disc) return disc < other.disc;
+      if (layout != other.layout) return layout < other.layout;
+      return wsIndex < other.wsIndex;
+    }
+  };
+
+  static GeometryCache& instance();
+
+  //! Sets the budget in MB of the discretization disc and drops its entries.
+  void setMemoryBudget(const void* disc, const double megabytes);
+
+  //! True if the discretization disc has a budget.
+  bool enabled(const void* disc) const { return budgets_.count(disc) > 0; }
+
+  //! Id of the evaluator inputs described by layout; the same description
+  //! always gets the same id.
+  int layoutId(const std::string& layout);
+
+  //! Entry stored under key, or NULL.
+  const Entry* find(const Key& key) const;
+
+  //! Stores entry under key, replacing the previous one. Returns false
+  //! (and stores nothing) if the entry does not fit in the budget.
+  bool insert(const Key& key, const Entry& entry);
+
+  //! Drops all entries.
+  void clear();
+
+  //! Drops the entries and the budget of the discretization disc.
+  void clear(const void* disc);
+
+  //! Bytes held by the entries.
+  std::size_t bytes() const { return bytes_; }
+
+  //! Bytes held by the entries of the discretization disc.
+  std::size_t bytes(const void* disc) const;
+
+private:
+
+  GeometryCache();
+
+  static std::size_t size(const Entry& entry);
+
+  static GeometryCache instance_;
+
+  std::map<std::string, int> layouts_;
+  std::map<Key, Entry> entries_;
+
+  //! Budget and bytes held, per discretization
+  struct Usage {
+    std::size_t budget, bytes;
+  };
+  std::map<const void*, Usage> budgets_;
+  std::size_t bytes_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_GEOMETRY_CACHE_HPP
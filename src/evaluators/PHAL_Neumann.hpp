@@ -9,6 +9,9 @@
 #ifndef PHAL_NEUMANN_HPP
 #define PHAL_NEUMANN_HPP
 
+#include <map>
+#include <vector>
+
 #include "Phalanx_config.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -214,6 +217,32 @@ protected:
 
   Kokkos::DynRankView<ScalarT, PHX::Device> data;
 
+  // Side geometry of the cells of a workset that share an element block and
+  // a local side. It only depends on the coordinates, so when MeshScalarT is
+  // RealType it is kept from one evaluation to the next and recomputed when
+  // the coordinates of the cells change (mesh motion, adaptation).
+  struct SideGeometry {
+    int numCells;
+    Kokkos::DynRankView<int, PHX::Device> cellVec;
+    // coordinates the geometry was computed from; empty if not computed
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsCell;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
+  };
+
+  struct WorksetSideGeometry {
+    // block, element and local side of each side of the side set
+    std::vector<int> sides;
+    std::vector<int> ebIndexVec;
+    // indexed by block ordinal * numSidesOnElem + local side
+    std::vector<SideGeometry> groups;
+  };
+
+  // by workset index
+  std::map<int, WorksetSideGeometry> sideGeometry;
+
   // Output:
   Kokkos::DynRankView<ScalarT, PHX::Device> neumann;
 
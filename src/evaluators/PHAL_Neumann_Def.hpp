@@ -8,6 +8,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include <string>
+#include <type_traits>
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -550,44 +551,64 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
   //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
   //! Also we do not know before the evaluator how many cells are associated to a local side id.
 
-  std::map<int, int> ordinalEbIndex;
-  std::vector<int> ebIndexVec;
-  std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
-  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device> > > cellsOnSidesOnBlocks;
-  for (auto const& it_side : sideSet) {
-    const int ebIndex = it_side.elem_ebIndex;
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
+  //! The grouping and the side geometry are kept per workset and rebuilt when the sides or the coordinates change.
 
-    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
-      numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
-      ebIndexVec.push_back(ebIndex);
-    }
+  const bool cacheGeometry = std::is_same<MeshScalarT, RealType>::value;
 
-    numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
+  std::vector<int> sides;
+  sides.reserve(3*sideSet.size());
+  for (auto const& it_side : sideSet) {
+    sides.push_back(it_side.elem_ebIndex);
+    sides.push_back(it_side.elem_LID);
+    sides.push_back(it_side.side_local_id);
   }
-  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
-  for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
-    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
-    for (int is=0; is<numSidesOnElem; is++) {
-      cellsOnSidesOnBlocks[ib][is] = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
-      numCellsOnSidesOnBlocks[ib][is]=0;
+
+  WorksetSideGeometry scratchGeometry;
+  WorksetSideGeometry& geometry = cacheGeometry ? sideGeometry[workset.wsIndex] : scratchGeometry;
+
+  if (geometry.groups.empty() || geometry.sides != sides) {
+    std::map<int, int> ordinalEbIndex;
+    std::vector<int>& ebIndexVec = geometry.ebIndexVec;
+    std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
+    ebIndexVec.clear();
+    for (auto const& it_side : sideSet) {
+      const int ebIndex = it_side.elem_ebIndex;
+      const int elem_side = it_side.side_local_id;
+
+      if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
+        numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
+        ebIndexVec.push_back(ebIndex);
+      }
+
+      numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
+    }
+    geometry.groups.assign(ordinalEbIndex.size()*numSidesOnElem, SideGeometry());
+    for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
+      for (int is=0; is<numSidesOnElem; is++) {
+        SideGeometry& group = geometry.groups[ib*numSidesOnElem + is];
+        group.cellVec = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
+        group.numCells = 0;
+      }
     }
-  }
 
-  for (auto const& it_side : sideSet) {
-    const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
+    for (auto const& it_side : sideSet) {
+      const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
+      const int elem_LID = it_side.elem_LID;
+      const int elem_side = it_side.side_local_id;
 
-    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
+      SideGeometry& group = geometry.groups[iBlock*numSidesOnElem + elem_side];
+      group.cellVec(group.numCells++) = elem_LID;
+    }
+    geometry.sides = sides;
   }
+  const std::vector<int>& ebIndexVec = geometry.ebIndexVec;
 
   // Loop over the sides that form the boundary condition
-  for (int iblock = 0; iblock < ordinalEbIndex.size(); ++iblock)
+  for (int iblock = 0; iblock < ebIndexVec.size(); ++iblock)
   for (int side = 0; side < numSidesOnElem; ++side)
   {
-    int numCells_ =  numCellsOnSidesOnBlocks[iblock][side];
+    SideGeometry& group = geometry.groups[iblock*numSidesOnElem + side];
+    int numCells_ = group.numCells;
     if( numCells_ == 0) continue;
 
     // Get the data that corresponds to the side
@@ -595,30 +616,64 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
     int sideDims = sideType[side]->getDimension();
     int numQPsSide = cubatureSide[side]->getNumPoints();
 
-    Kokkos::DynRankView<int, PHX::Device> cellVec  = cellsOnSidesOnBlocks[iblock][side];
+    Kokkos::DynRankView<int, PHX::Device> cellVec  = group.cellVec;
 
+    physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
+
+    // Copy the coordinate data over to a temp container
+    for (std::size_t node=0; node < numNodes; ++node)
+      for (std::size_t dim=0; dim < cellDims; ++dim)
+        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
+          physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
+
+    // Reuse the side geometry if these cells have not moved
+    bool haveGeometry = cacheGeometry && group.physPointsCell.size() > 0;
+    for (std::size_t node=0; haveGeometry && node < numNodes; ++node)
+      for (std::size_t dim=0; haveGeometry && dim < cellDims; ++dim)
+        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
+          if (physPointsCell(iCell, node, dim) != group.physPointsCell(iCell, node, dim)) {
+            haveGeometry = false;
+            break;
+          }
+
+    if (haveGeometry) {
+      physPointsSide = group.physPointsSide;
+      jacobianSide = group.jacobianSide;
+      trans_basis_refPointsSide = group.trans_basis_refPointsSide;
+      weighted_trans_basis_refPointsSide = group.weighted_trans_basis_refPointsSide;
+    }
+    else {
     //need to resize containers because they depend on side topology
     cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
     refPointsSide = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
     cubWeightsSide = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
     basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
 
-    physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
-    jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
     jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
     weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
-    trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
-    
 
-    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
+    if (cacheGeometry) {
+      // MeshScalarT is RealType here, so the views need no derivative dimension
+      group.physPointsCell = DynRankViewMeshScalarT("physPointsCell", numCells_, numNodes, cellDims);
+      group.physPointsSide = DynRankViewMeshScalarT("physPointsSide", numCells_, numQPsSide, cellDims);
+      group.jacobianSide = DynRankViewMeshScalarT("jacobianSide", numCells_, numQPsSide, cellDims, cellDims);
+      group.trans_basis_refPointsSide = DynRankViewMeshScalarT("trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+      group.weighted_trans_basis_refPointsSide = DynRankViewMeshScalarT("weighted_trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+      Kokkos::deep_copy(group.physPointsCell, physPointsCell);
+
+      physPointsSide = group.physPointsSide;
+      jacobianSide = group.jacobianSide;
+      trans_basis_refPointsSide = group.trans_basis_refPointsSide;
+      weighted_trans_basis_refPointsSide = group.weighted_trans_basis_refPointsSide;
+    }
+    else {
+      physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
+      jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
+      trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
+      weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
+    }
 
-    // Copy the coordinate data over to a temp container
-    for (std::size_t node=0; node < numNodes; ++node)
-      for (std::size_t dim=0; dim < cellDims; ++dim)
-        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
-          physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
+    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
 
     // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
     Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell
@@ -653,6 +708,7 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
     // Map cell (reference) cubature points to the appropriate side (elem_side) in physical space
     Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame
       (physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
+    }
 
 
     // Map cell (reference) degree of freedom points to the appropriate side (elem_side)
@@ -0,0 +1,85 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_NODESET_FUNCTION_CACHE_HPP
+#define PHAL_NODESET_FUNCTION_CACHE_HPP
+
+#include <algorithm>
+#include <vector>
+
+namespace PHAL {
+
+/*! \brief Values of a function of the coordinates on the nodes of a node set.
+ *
+ *  Boundary conditions of the form u(x,t) = sum_k a_k(t) g_k(x) only need
+ *  the spatial parts g_k once per mesh; each fill then applies the time
+ *  factors a_k. The cache evaluates the spatial parts of all nodes of a node
+ *  set into one contiguous, node-major array and reuses it until the node
+ *  set coordinates change, e.g. after adaptation or a coordinate update.
+ *  The first numDims coordinates of every node, the ones g_k may depend on,
+ *  are kept by value and compared at each call, so that coordinates that
+ *  are updated in place are detected as well.
+ */
+class NodeSetFunctionCache {
+public:
+  NodeSetFunctionCache(const int numDims, const int numValues) :
+    numDims_(numDims),
+    numValues_(numValues) {}
+
+  //! Number of values per node.
+  int numValues() const { return numValues_; }
+
+  /*! \brief Spatial values of all nodes, numValues() per node.
+   *
+   *  \c f(coord, values) fills the values of one node. It is called for
+   *  every node when the node set is new and not at all otherwise.
+   */
+  template <typename Function>
+  const double* values(const std::vector<double*>& nsNodeCoords,
+                       const Function& f)
+  {
+    if (!sameCoords(nsNodeCoords)) {
+      const std::size_t numNodes = nsNodeCoords.size();
+      coords_.resize(numDims_ * numNodes);
+      values_.resize(numValues_ * numNodes);
+      for (std::size_t inode = 0; inode < numNodes; ++inode) {
+        std::copy(nsNodeCoords[inode], nsNodeCoords[inode] + numDims_,
+                  &coords_[numDims_ * inode]);
+        f(nsNodeCoords[inode], &values_[numValues_ * inode]);
+      }
+      valid_ = true;
+    }
+    return values_.empty() ? NULL : &values_[0];
+  }
+
+  //! Forget the cached values.
+  void clear() {
+    coords_.clear();
+    values_.clear();
+    valid_ = false;
+  }
+
+private:
+  bool sameCoords(const std::vector<double*>& nsNodeCoords) const {
+    if (!valid_ || numDims_ * nsNodeCoords.size() != coords_.size())
+      return false;
+    for (std::size_t inode = 0; inode < nsNodeCoords.size(); ++inode)
+      if (!std::equal(nsNodeCoords[inode], nsNodeCoords[inode] + numDims_,
+                      &coords_[numDims_ * inode]))
+        return false;
+    return true;
+  }
+
+  std::size_t numDims_;
+  int numValues_;
+  bool valid_ = false;
+  std::vector<double> coords_;
+  std::vector<double> values_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_NODESET_FUNCTION_CACHE_HPP
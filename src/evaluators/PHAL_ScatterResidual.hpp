@@ -176,6 +176,17 @@ public:
   typedef typename Tpetra_CrsMatrix::local_matrix_type  LocalMatrixType;
   LocalMatrixType jacobian;
 
+  //! With a coloring of the workset the kernels run color by color over
+  //! wsColorCells_kokkos and sum into the matrix without atomics
+  bool colored;
+  Kokkos::View<int*, PHX::Device> colorCells;
+
+  KOKKOS_INLINE_FUNCTION
+  int cellOf(const int i) const { return colored ? colorCells(i) : i; }
+
+  template <typename Policy>
+  void launch(typename Traits::EvalData workset);
+
   struct ScatterRank0_is_adjoint_Tag{};
   struct ScatterRank0_no_adjoint_Tag{};
   struct ScatterRank1_is_adjoint_Tag{};
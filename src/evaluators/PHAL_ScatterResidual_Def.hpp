@@ -236,8 +236,9 @@ ScatterResidual(const Teuchos::ParameterList& p,
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank0_is_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank0_is_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
 // const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
   //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -263,7 +264,7 @@ operator()(const ScatterRank0_is_adjoint_Tag& tag, const int& cell) const
            if (((this->val[eq])(cell,node)).hasFastAccess()) {  
                for (int lunk=0; lunk<nunk; lunk++){
                    ST val = ((this->val[eq])(cell,node)).fastAccessDx(lunk);
-                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, true); 
+                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, !colored); 
                }
             }//has fast access
       }
@@ -274,8 +275,9 @@ operator()(const ScatterRank0_is_adjoint_Tag& tag, const int& cell) const
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank0_no_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank0_no_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
 //  const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
   //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -302,7 +304,7 @@ operator()(const ScatterRank0_no_adjoint_Tag& tag, const int& cell) const
               fT->sumIntoLocalValue(rowT, ((this->val[eq])(cell,node)).val());
            if (((this->val[eq])(cell,node)).hasFastAccess()) {
              for (int i = 0; i < nunk; ++i) vals[i] = this->val[eq](cell,node).fastAccessDx(i);
-                jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, true);
+                jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, !colored);
 //              jacobian.sumIntoValues(rowT, &colT[0], nunk,  &vals[0], true);  
         }
       }
@@ -314,8 +316,9 @@ operator()(const ScatterRank0_no_adjoint_Tag& tag, const int& cell) const
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank1_is_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank1_is_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
 //  const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
   //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -343,7 +346,7 @@ operator()(const ScatterRank1_is_adjoint_Tag& tag, const int& cell) const
            if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
                for (int lunk=0; lunk<nunk; lunk++){
                    ST val = ((this->valVec)(cell,node,eq)).fastAccessDx(lunk);
-                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, true);
+                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, !colored);
                }
             }//has fast access
       }
@@ -354,8 +357,9 @@ operator()(const ScatterRank1_is_adjoint_Tag& tag, const int& cell) const
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank1_no_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank1_no_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
  // const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
 //  //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -382,7 +386,7 @@ operator()(const ScatterRank1_no_adjoint_Tag& tag, const int& cell) const
               fT->sumIntoLocalValue(rowT, ((this->valVec)(cell,node,eq)).val());
            if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
              for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell,node,eq).fastAccessDx(i);
-              jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, true);
+              jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, !colored);
 //              jacobian.sumIntoValues(rowT, &colT[0], nunk, &vals[0], true);
         }
       }
@@ -393,8 +397,9 @@ operator()(const ScatterRank1_no_adjoint_Tag& tag, const int& cell) const
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank2_is_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank2_is_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
   //const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
   //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -420,7 +425,7 @@ operator()(const ScatterRank2_is_adjoint_Tag& tag, const int& cell) const
            if (((this->valTensor[0])(cell,node, eq/numDim, eq%numDim)).hasFastAccess()) {
                for (int lunk=0; lunk<nunk; lunk++){
                     ST val = ((this->valTensor[0])(cell,node, eq/numDim, eq%numDim)).fastAccessDx(lunk);
-                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, true);
+                    jacobian.sumIntoValues (colT[lunk], &rowT, 1, &val, false, !colored);
                }
             }//has fast access
       }
@@ -431,8 +436,9 @@ operator()(const ScatterRank2_is_adjoint_Tag& tag, const int& cell) const
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
-operator()(const ScatterRank2_no_adjoint_Tag& tag, const int& cell) const
+operator()(const ScatterRank2_no_adjoint_Tag& tag, const int& i) const
 {
+  const int cell = cellOf(i);
   //const int neq = workset.wsElNodeEqID[0][0].size();
 //  const int nunk = neq*this->numNodes;
    //Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -459,14 +465,31 @@ operator()(const ScatterRank2_no_adjoint_Tag& tag, const int& cell) const
               fT->sumIntoLocalValue(rowT, ((this->valTensor[0])(cell,node, eq/numDim, eq%numDim)).val());
            if (((this->valTensor[0])(cell,node, eq/numDim, eq%numDim)).hasFastAccess()) {
              for (int i = 0; i < nunk; ++i) vals[i] = (this->valTensor[0])(cell,node, eq/numDim, eq%numDim).fastAccessDx(i);
-              jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, true);
+              jacobian.sumIntoValues(rowT, colT, nunk,  vals, false, !colored);
            //   jacobian.sumIntoValues(rowT, &colT[0], nunk, &vals[0], true);
         }
       }
    }
 
 }
+
+// **********************************************************************
+template<typename Traits>
+template<typename Policy>
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
+launch(typename Traits::EvalData workset)
+{
+  if (!colored) {
+    Kokkos::parallel_for(Policy(0,workset.numCells),*this);
+    return;
+  }
+  // Cells of one color share no row; the colors run one after the other
+  for (int color = 0; color < workset.wsColorOffsets.size() - 1; ++color)
+    Kokkos::parallel_for(Policy(workset.wsColorOffsets[color],
+                                workset.wsColorOffsets[color+1]),*this);
+}
 #endif
+
 // **********************************************************************
 template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
@@ -538,24 +561,27 @@ evaluateFields(typename Traits::EvalData workset)
    if(this->tensorRank==2)
      numDim = this->valTensor[0].dimension(2);
 
+   colored = workset.wsColorOffsets.size() > 1;
+   colorCells = workset.wsColorCells_kokkos;
+
    if (this->tensorRank == 0) {
       if (workset.is_adjoint) 
-         Kokkos::parallel_for(ScatterRank0_is_adjoint_Policy(0,workset.numCells),*this);  
+         launch<ScatterRank0_is_adjoint_Policy>(workset);
       else
-         Kokkos::parallel_for(ScatterRank0_no_adjoint_Policy(0,workset.numCells),*this);
+         launch<ScatterRank0_no_adjoint_Policy>(workset);
    }
    else  if (this->tensorRank == 1) {
        if (workset.is_adjoint) 
-          Kokkos::parallel_for(ScatterRank1_is_adjoint_Policy(0,workset.numCells),*this);
+          launch<ScatterRank1_is_adjoint_Policy>(workset);
        else
-          Kokkos::parallel_for(ScatterRank1_no_adjoint_Policy(0,workset.numCells),*this);
+          launch<ScatterRank1_no_adjoint_Policy>(workset);
 
    }
    else if (this->tensorRank == 2) {
         if (workset.is_adjoint) 
-            Kokkos::parallel_for(ScatterRank2_is_adjoint_Policy(0,workset.numCells),*this);
+            launch<ScatterRank2_is_adjoint_Policy>(workset);
         else
-            Kokkos::parallel_for(ScatterRank2_no_adjoint_Policy(0,workset.numCells),*this);
+            launch<ScatterRank2_no_adjoint_Policy>(workset);
    }
 #ifdef ALBANY_TIMER
   PHX::Device::fence();
@@ -1002,11 +1028,16 @@ evaluateFields(typename Traits::EvalData workset)
 {
   Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
 
+  // Tpetra fill: column block of mp_fT is ensemble member block
+  const bool tpetra = Teuchos::nonnull(workset.mp_fT);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT;
+  if (tpetra) fT = workset.mp_fT->get2dViewNonConst();
+
   int numDim=0;
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
-  int nblock = f->size();
+  int nblock = tpetra ? fT.size() : f->size();
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
 
@@ -1017,8 +1048,12 @@ evaluateFields(typename Traits::EvalData workset)
           valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
-        for (int block=0; block<nblock; block++)
-          (*f)[block][nodeID[node][this->offset + eq]] += valptr.coeff(block);
+        if (tpetra)
+          for (int block=0; block<nblock; block++)
+            fT[block][nodeID[node][this->offset + eq]] += valptr.coeff(block);
+        else
+          for (int block=0; block<nblock; block++)
+            (*f)[block][nodeID[node][this->offset + eq]] += valptr.coeff(block);
       }
     }
   }
@@ -1046,15 +1081,24 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > Jac =
     workset.mp_Jac;
 
+  // Tpetra fill: column (entry) block of mp_fT (mp_JacT) is ensemble member
+  // block
+  const bool tpetra = Teuchos::nonnull(workset.mp_JacT);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT;
+  if (tpetra && Teuchos::nonnull(workset.mp_fT))
+    fT = workset.mp_fT->get2dViewNonConst();
+  const bool fill_f = tpetra ? Teuchos::nonnull(workset.mp_fT) : (f != Teuchos::null);
+
   int row, lcol;
   int nblock = 0;
-  if (f != Teuchos::null)
-    nblock = f->size();
-  int nblock_jac = Jac->size();
+  if (fill_f)
+    nblock = tpetra ? fT.size() : f->size();
+  int nblock_jac = tpetra ? workset.mp_JacT->size() : Jac->size();
   const int neq = workset.wsElNodeEqID[0][0].size();
   const int nunk = neq*this->numNodes;
   Teuchos::Array<double> val(nunk); // use double since it goes into CrsMatrix
   Teuchos::Array<int> col(nunk);
+  Teuchos::Array<LO> colT(nunk);
 
   int numDim=0;
   if(this->tensorRank==2)
@@ -1073,9 +1117,13 @@ evaluateFields(typename Traits::EvalData workset)
 
         row = nodeID[node][this->offset + eq];
 
-        if (f != Teuchos::null) {
-          for (int block=0; block<nblock; block++)
-            (*f)[block].SumIntoMyValue(row, 0, valptr.val().coeff(block));
+        if (fill_f) {
+          if (tpetra)
+            for (int block=0; block<nblock; block++)
+              fT[block][row] += valptr.val().coeff(block);
+          else
+            for (int block=0; block<nblock; block++)
+              (*f)[block].SumIntoMyValue(row, 0, valptr.val().coeff(block));
         }
 
         // Check derivative array is nonzero
@@ -1095,6 +1143,7 @@ evaluateFields(typename Traits::EvalData workset)
 
                 // Global column
                 col[lcol] =  nodeID[node_col][eq_col];
+                colT[lcol] = nodeID[node_col][eq_col];
 
                 // Matrix value
                 val[lcol] = valptr.fastAccessDx(lcol).coeff(block);
@@ -1104,8 +1153,11 @@ evaluateFields(typename Traits::EvalData workset)
             } // column nodes
 
             // Sum Jacobian
-            (*Jac)[block].SumIntoMyValues(row, nunk,
-                                          val.getRawPtr(), col.getRawPtr());
+            if (tpetra)
+              (*workset.mp_JacT)[block]->sumIntoLocalValues(row, colT(), val());
+            else
+              (*Jac)[block].SumIntoMyValues(row, nunk,
+                                            val.getRawPtr(), col.getRawPtr());
 
           } // has fast access
 
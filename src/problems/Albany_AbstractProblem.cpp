@@ -158,6 +158,18 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
+  validPL->set<bool>("Matrix-Free Jacobian", false,
+                     "Apply the Jacobian through directional derivatives instead of assembling it");
+  validPL->set<std::string>("Matrix-Free Preconditioner", "None",
+                     "Preconditioner of the matrix-free Jacobian: None or Ifpack2 (computed from the assembled Jacobian)");
+  validPL->set<std::string>("Matrix-Free Ifpack2 Type", "RILUK",
+                     "Ifpack2 preconditioner type of the matrix-free Jacobian");
+  validPL->sublist("Matrix-Free Ifpack2 Parameters", false,
+                     "Ifpack2 parameters of the matrix-free Jacobian preconditioner");
+  validPL->set<double>("Geometry Cache Memory Budget", 0.0,
+                     "Memory (MB) for the element geometry shared by all evaluation types; 0 (default) recomputes it in every fill");
+  validPL->set<bool>("Stacked SG Jacobian Export", true,
+                     "Export all SG Jacobian blocks in one message per neighbor, at the cost of a second copy of the blocks");
 
   validPL->sublist("Model Order Reduction", false, "Specify the options relative to model order reduction");
 
@@ -278,6 +278,10 @@ void Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList (
         p->set< int > ("Equation Offset", j);
         offsets_[i].push_back(j); 
         p->set<RCP<ParamLib> >("Parameter Library", paramLib);
+        p->set<bool>("Symmetric Elimination", BCparams.get<bool>("Symmetric Elimination", false));
+        // The Residual and Jacobian evaluators lift the same columns
+        p->set<RCP<PHAL::DirichletRowEliminator> >("Row Eliminator",
+                                                   rcp(new PHAL::DirichletRowEliminator));
 
         evaluators_to_build[evaluatorsToBuildName(ss)] = p;
 
@@ -1175,6 +1179,9 @@ Albany::DirichletTraits::getValidBCParameters(
     validPL->sublist(pd, false, "");
   }
 
+  validPL->set<bool>("Symmetric Elimination", false,
+                     "Also zero the columns of constant-value DBCs, keeping a symmetric Jacobian symmetric");
+
   return validPL;
 }
 
@@ -0,0 +1,98 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include "ActiveRegion.hpp"
+
+#include <fstream>
+
+namespace
+{
+
+// Laser moving along the x axis from (0,0) to (1,0) over t in [0,1]
+void writeLaserPath()
+{
+  std::ofstream os("LaserCenter.txt");
+  os << "0.0 0.0 0.0 1 1.0\n"
+     << "1.0 1.0 0.0 1 1.0\n";
+}
+
+// Single cell workset, a unit square with lower left corner (x,y)
+struct SquareWorkset
+{
+  double coords[4][3];
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords;
+  PHAL::Workset workset;
+
+  SquareWorkset() : wsCoords(1)
+  {
+    wsCoords[0] = Teuchos::ArrayRCP<double*>(4);
+    for (int node = 0; node < 4; ++node)
+      wsCoords[0][node] = coords[node];
+    workset.wsIndex = 0;
+    workset.numCells = 1;
+    workset.wsCoords = wsCoords;
+    workset.current_time = 0.5;
+  }
+
+  // The mesh changes under the workset: same index and number of cells
+  void moveTo(const double x, const double y)
+  {
+    const double dx[4] = {0.0, 1.0, 1.0, 0.0}, dy[4] = {0.0, 0.0, 1.0, 1.0};
+    for (int node = 0; node < 4; ++node) {
+      coords[node][0] = x + dx[node];
+      coords[node][1] = y + dy[node];
+      coords[node][2] = 0.0;
+    }
+  }
+};
+
+TEUCHOS_UNIT_TEST(ActiveRegion, FollowsMeshChanges)
+{
+  writeLaserPath();
+  Teuchos::ParameterList p;
+  p.set("Radius", 0.5);
+  AMP::ActiveRegion region(p);
+
+  SquareWorkset ws;
+
+  // Laser at (0.5,0) inside the square
+  ws.moveTo(0.0, -0.5);
+  TEST_ASSERT(region.isActive(ws.workset));
+
+  // Same time and workset index after adaptation moved the cell away
+  ws.moveTo(5.0, 5.0);
+  TEST_ASSERT(!region.isActive(ws.workset));
+
+  // Back within the radius of the path
+  ws.moveTo(0.0, 0.4);
+  TEST_ASSERT(region.isActive(ws.workset));
+
+  // Out of reach at both times: the path ends at (1,0)
+  ws.moveTo(2.0, -0.5);
+  TEST_ASSERT(!region.isActive(ws.workset));
+  ws.workset.current_time = 1.0;
+  TEST_ASSERT(!region.isActive(ws.workset));
+}
+
+TEUCHOS_UNIT_TEST(ActiveRegion, LookAheadActivatesBeforeTheLaser)
+{
+  writeLaserPath();
+  Teuchos::ParameterList p;
+  p.set("Radius", 0.1);
+  p.set("Look Ahead Time", 0.5);
+  AMP::ActiveRegion region(p);
+
+  // The path up to t + 0.5 ends 0.2 short of the square at t = 0 and
+  // reaches it at t = 0.2
+  SquareWorkset ws;
+  ws.moveTo(0.7, -0.5);
+  ws.workset.current_time = 0.0;
+  TEST_ASSERT(!region.isActive(ws.workset));
+  ws.workset.current_time = 0.2;
+  TEST_ASSERT(region.isActive(ws.workset));
+}
+
+} // namespace
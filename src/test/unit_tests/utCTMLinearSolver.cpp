@@ -0,0 +1,109 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include "Albany_Utils.hpp"
+#include "linear_solver.hpp"
+
+namespace
+{
+
+const int n = 12;  // n by n grid
+
+// 5-point Laplacian on an n by n grid, one row per grid point
+Teuchos::RCP<Tpetra_CrsMatrix>
+laplacian(const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  const Teuchos::RCP<const Tpetra_Map> map =
+    Teuchos::rcp(new Tpetra_Map(n * n, 0, commT));
+  const Teuchos::RCP<Tpetra_CrsGraph> graph = Teuchos::rcp(new Tpetra_CrsGraph(map, 5));
+  for (std::size_t k = 0; k < map->getNodeNumElements(); ++k) {
+    const GO row = map->getGlobalElement(k);
+    const GO i = row % n, j = row / n;
+    Teuchos::Array<GO> cols(1, row);
+    if (i > 0) cols.push_back(row - 1);
+    if (i < n - 1) cols.push_back(row + 1);
+    if (j > 0) cols.push_back(row - n);
+    if (j < n - 1) cols.push_back(row + n);
+    graph->insertGlobalIndices(row, cols());
+  }
+  graph->fillComplete();
+
+  // Static graph, so value changes below leave the graph object in place
+  const Teuchos::RCP<Tpetra_CrsMatrix> A = Teuchos::rcp(new Tpetra_CrsMatrix(graph));
+  A->setAllToScalar(-1.0);
+  for (std::size_t k = 0; k < map->getNodeNumElements(); ++k) {
+    const GO row = map->getGlobalElement(k);
+    A->replaceGlobalValues(row, Teuchos::tuple<GO>(row), Teuchos::tuple<ST>(4.0));
+  }
+  A->fillComplete();
+  return A;
+}
+
+// Changes the values of A in place, as a new Newton iteration does
+void updateValues(Tpetra_CrsMatrix& A)
+{
+  const Teuchos::RCP<const Tpetra_Map> map = A.getRowMap();
+  A.resumeFill();
+  for (std::size_t k = 0; k < map->getNodeNumElements(); ++k) {
+    const GO row = map->getGlobalElement(k);
+    A.replaceGlobalValues(row, Teuchos::tuple<GO>(row), Teuchos::tuple<ST>(4.5 + 0.01 * (row % 7)));
+  }
+  A.fillComplete();
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+linearAlgebra(const std::string& reuse)
+{
+  const Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList);
+  p->set("Preconditioner Reuse", reuse);
+  Teuchos::ParameterList& gmres = p->sublist("GMRES Solver");
+  gmres.set("Linear Tolerance", 1.0e-10);
+  gmres.set("Linear Max. Iterations", 200);
+  gmres.set("Linear Krylov Size", 200);
+  return p;
+}
+
+TEUCHOS_UNIT_TEST(CTMLinearSolver, SymbolicReuseMatchesRebuild)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  const Teuchos::RCP<Tpetra_CrsMatrix> A = laplacian(commT);
+  const Teuchos::RCP<const Tpetra_CrsGraph> graph = A->getCrsGraph();
+
+  const Teuchos::RCP<Tpetra_Vector> b = Teuchos::rcp(new Tpetra_Vector(A->getRowMap()));
+  b->randomize();
+
+  // First solve sets up the kept preconditioner
+  CTM::LinearSolver reused(linearAlgebra("Symbolic"));
+  const Teuchos::RCP<Tpetra_Vector> x_first = Teuchos::rcp(new Tpetra_Vector(A->getRowMap()));
+  reused.solve(A, x_first, b);
+
+  updateValues(*A);
+  TEST_EQUALITY(A->getCrsGraph().get(), graph.get());
+
+  // Second solve recomputes only the numeric factorization of the kept object
+  const Teuchos::RCP<Tpetra_Vector> x_reused = Teuchos::rcp(new Tpetra_Vector(A->getRowMap()));
+  reused.solve(A, x_reused, b);
+
+  // A preconditioner built from scratch for the updated values
+  CTM::LinearSolver rebuilt(linearAlgebra("None"));
+  const Teuchos::RCP<Tpetra_Vector> x_rebuilt = Teuchos::rcp(new Tpetra_Vector(A->getRowMap()));
+  rebuilt.solve(A, x_rebuilt, b);
+
+  // Same operator, preconditioner, right-hand side and initial guess, so GMRES
+  // follows the same iterates
+  const ST norm = x_rebuilt->norm2();
+  TEST_COMPARE(norm, >, 0.0);
+  x_reused->update(-1.0, *x_rebuilt, 1.0);
+  TEST_COMPARE(x_reused->norm2(), <=, 1.0e-12 * norm);
+
+  // The first solution was for the old values
+  x_first->update(-1.0, *x_rebuilt, 1.0);
+  TEST_COMPARE(x_first->norm2(), >, 1.0e-6 * norm);
+}
+
+} // namespace
@@ -0,0 +1,85 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Albany_ElementColoring.hpp"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+
+// (cell, node) -> node GID map of an nx by ny grid of quads, cells row by row
+Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >
+quadGrid(const int nx, const int ny)
+{
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > elNodeID(nx * ny);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      Teuchos::ArrayRCP<GO> nodes(4);
+      nodes[0] = i + j * (nx + 1);
+      nodes[1] = nodes[0] + 1;
+      nodes[2] = nodes[1] + nx + 1;
+      nodes[3] = nodes[0] + nx + 1;
+      elNodeID[i + j * nx] = nodes;
+    }
+  }
+  return elNodeID;
+}
+
+TEUCHOS_UNIT_TEST(ElementColoring, CellsOfAColorShareNoNode)
+{
+  const int nx = 7, ny = 5;
+  const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > elNodeID = quadGrid(nx, ny);
+  const Albany::WorksetColoring coloring = Albany::colorWorkset(elNodeID);
+
+  // Greedy coloring of a structured quad grid in row order needs 4 colors
+  TEST_EQUALITY(coloring.numColors(), 4);
+  TEST_EQUALITY(coloring.offsets[0], 0);
+  TEST_EQUALITY(coloring.offsets[coloring.numColors()], nx * ny);
+  TEST_EQUALITY(static_cast<int>(coloring.cells.size()), nx * ny);
+
+  // Every cell appears once
+  std::vector<int> count(nx * ny, 0);
+  for (int k = 0; k < coloring.cells.size(); ++k) {
+    TEST_COMPARE(coloring.cells[k], >=, 0);
+    TEST_COMPARE(coloring.cells[k], <, nx * ny);
+    ++count[coloring.cells[k]];
+  }
+  for (int cell = 0; cell < nx * ny; ++cell)
+    TEST_EQUALITY(count[cell], 1);
+
+  for (int c = 0; c < coloring.numColors(); ++c) {
+    TEST_COMPARE(coloring.offsets[c], <, coloring.offsets[c + 1]);
+
+    // No node is touched twice within a color
+    std::set<GO> nodes;
+    for (int k = coloring.offsets[c]; k < coloring.offsets[c + 1]; ++k) {
+      const Teuchos::ArrayRCP<GO>& cellNodes = elNodeID[coloring.cells[k]];
+      for (int j = 0; j < cellNodes.size(); ++j)
+        TEST_ASSERT(nodes.insert(cellNodes[j]).second);
+    }
+  }
+
+  // The device copy holds the same cells
+  const Kokkos::View<int*, PHX::Device>::HostMirror cells_host =
+    Kokkos::create_mirror_view(coloring.cells_kokkos);
+  Kokkos::deep_copy(cells_host, coloring.cells_kokkos);
+  TEST_EQUALITY(static_cast<int>(cells_host.dimension_0()), nx * ny);
+  for (int k = 0; k < nx * ny; ++k)
+    TEST_EQUALITY(cells_host(k), coloring.cells[k]);
+}
+
+TEUCHOS_UNIT_TEST(ElementColoring, EmptyWorkset)
+{
+  const Albany::WorksetColoring coloring =
+    Albany::colorWorkset(Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >());
+
+  TEST_EQUALITY(coloring.numColors(), 0);
+  TEST_EQUALITY(static_cast<int>(coloring.cells.size()), 0);
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_Application.hpp"
+#include "Albany_ModelEvaluator.hpp"
+#include "Albany_Utils.hpp"
+#include "QCAD_GenEigensolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+const char input[] =
+  "<ParameterList>"
+  "  <ParameterList name=\"Problem\">"
+  "    <Parameter name=\"Name\" type=\"string\" value=\"Schrodinger 1D\"/>"
+  "    <Parameter name=\"Solution Method\" type=\"string\" value=\"Eigensolve\"/>"
+  "    <Parameter name=\"Energy Unit In Electron Volts\" type=\"double\" value=\"1e-3\"/>"
+  "    <Parameter name=\"Length Unit In Meters\" type=\"double\" value=\"1e-9\"/>"
+  "    <ParameterList name=\"Dirichlet BCs\">"
+  "      <Parameter name=\"DBC on NS NodeSet0 for DOF psi\" type=\"double\" value=\"0.0\"/>"
+  "      <Parameter name=\"DBC on NS NodeSet1 for DOF psi\" type=\"double\" value=\"0.0\"/>"
+  "    </ParameterList>"
+  "    <ParameterList name=\"Potential\">"
+  "      <Parameter name=\"Type\" type=\"string\" value=\"Parabolic\"/>"
+  "      <Parameter name=\"E0\" type=\"double\" value=\"1e4\"/>"
+  "      <Parameter name=\"Scaling Factor\" type=\"double\" value=\"1.0\"/>"
+  "    </ParameterList>"
+  "    <ParameterList name=\"Parameters\">"
+  "      <Parameter name=\"Number\" type=\"int\" value=\"1\"/>"
+  "      <Parameter name=\"Parameter 0\" type=\"string\" value=\"Schrodinger Potential Scaling Factor\"/>"
+  "    </ParameterList>"
+  "    <ParameterList name=\"Response Functions\">"
+  "      <Parameter name=\"Number\" type=\"int\" value=\"1\"/>"
+  "      <Parameter name=\"Response 0\" type=\"string\" value=\"Solution Average\"/>"
+  "    </ParameterList>"
+  "  </ParameterList>"
+  "  <ParameterList name=\"Discretization\">"
+  "    <Parameter name=\"1D Elements\" type=\"int\" value=\"100\"/>"
+  "    <Parameter name=\"Method\" type=\"string\" value=\"STK1D\"/>"
+  "  </ParameterList>"
+  "</ParameterList>";
+
+// An Albany Schrodinger model and a GenEigensolver on it
+struct Eigensolve
+{
+  Teuchos::RCP<Albany::Application> app;
+  Teuchos::RCP<EpetraExt::ModelEvaluator> model;
+  Teuchos::RCP<QCAD::GenEigensolver> solver;
+
+  Eigensolve(const Teuchos::RCP<const Teuchos_Comm>& commT, const bool warmStart)
+  {
+    const Teuchos::RCP<Teuchos::ParameterList> params = Teuchos::getParametersFromXmlString(input);
+    app = Teuchos::rcp(new Albany::Application(commT, params));
+    model = Teuchos::rcp(new Albany::ModelEvaluator(app, params));
+
+    const Teuchos::RCP<Teuchos::ParameterList> eigList = Teuchos::rcp(new Teuchos::ParameterList);
+    eigList->set("Num Eigenvalues", 3);
+    eigList->set("Block Size", 3);
+    eigList->set("Convergece Tolerance", 1.0e-10);
+    eigList->set("Warm Start", warmStart);
+    const Teuchos::RCP<Albany::StateManager> observer = Teuchos::rcpFromRef(app->getStateMgr());
+    solver = Teuchos::rcp(new QCAD::GenEigensolver(eigList, model, observer,
+        Albany::createEpetraCommFromTeuchosComm(commT)));
+  }
+
+  // Eigenvalues for the potential scaled by scale
+  std::vector<double> solve(const double scale)
+  {
+    const Teuchos::RCP<Epetra_Vector> p = Teuchos::rcp(new Epetra_Vector(*model->get_p_map(0)));
+    p->PutScalar(scale);
+    EpetraExt::ModelEvaluator::InArgs inArgs = solver->createInArgs();
+    inArgs.set_p(0, p);
+    solver->evalModel(inArgs, solver->createOutArgs());
+    return *app->getStateMgr().getEigenData()->eigenvalueRe;
+  }
+};
+
+TEUCHOS_UNIT_TEST(GenEigensolver, WarmStartMatchesColdStart)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  // Second solve of a Poisson-Schrodinger-like sequence, seeded by the first
+  Eigensolve warm(commT, true);
+  warm.solve(1.0);
+  const int firstIters = warm.solver->getTotalIterations();
+  const std::vector<double> warmEvals = warm.solve(1.05);
+  const int warmIters = warm.solver->getTotalIterations() - firstIters;
+
+  // The same problem from a random start
+  Eigensolve cold(commT, false);
+  const std::vector<double> coldEvals = cold.solve(1.05);
+  const int coldIters = cold.solver->getTotalIterations();
+
+  TEST_EQUALITY(warmEvals.size(), coldEvals.size());
+  TEST_EQUALITY(static_cast<int>(warmEvals.size()), 3);
+  for (std::size_t i = 0; i < std::min(warmEvals.size(), coldEvals.size()); ++i)
+    TEST_COMPARE(std::abs(warmEvals[i] - coldEvals[i]), <=, 1.0e-6 * std::abs(coldEvals[i]));
+
+  // The previous eigenvectors are close, so LOBPCG has less to do
+  TEST_COMPARE(warmIters, <=, coldIters);
+}
+
+} // namespace
@@ -0,0 +1,60 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include "PHAL_GeometryCache.hpp"
+
+namespace
+{
+
+// Entry of 1024 RealType values
+PHAL::GeometryCache::Entry entry()
+{
+  PHAL::GeometryCache::Entry e;
+  e.coords = PHAL::GeometryCache::View("coords", 16, 4, 2);
+  e.fields.push_back(PHAL::GeometryCache::View("field", 16, 56));
+  return e;
+}
+
+TEUCHOS_UNIT_TEST(GeometryCache, BudgetsArePerDiscretization)
+{
+  PHAL::GeometryCache& cache = PHAL::GeometryCache::instance();
+  const int disc_a = 0, disc_b = 0;  // stand-ins for two discretizations
+  const PHAL::GeometryCache::Entry e = entry();
+  const std::size_t entry_bytes = 1024 * sizeof(RealType);
+  const double mb = 1.0 / (1 << 20);
+  const int layout = cache.layoutId("utGeometryCache");
+
+  // Room for two entries of disc_a
+  cache.setMemoryBudget(&disc_a, 2 * entry_bytes * mb);
+  const PHAL::GeometryCache::Key a0 = { &disc_a, layout, 0 }, a1 = { &disc_a, layout, 1 },
+    a2 = { &disc_a, layout, 2 };
+  TEST_ASSERT(cache.insert(a0, e));
+  TEST_ASSERT(cache.insert(a1, e));
+  TEST_ASSERT(!cache.insert(a2, e));
+  TEST_EQUALITY(cache.bytes(&disc_a), 2 * entry_bytes);
+
+  // A second application sets its own budget; disc_a keeps its entries
+  cache.setMemoryBudget(&disc_b, entry_bytes * mb);
+  TEST_ASSERT(cache.enabled(&disc_a));
+  TEST_ASSERT(cache.find(a0) != NULL);
+  TEST_ASSERT(cache.find(a1) != NULL);
+  const PHAL::GeometryCache::Key b0 = { &disc_b, layout, 0 }, b1 = { &disc_b, layout, 1 };
+  TEST_ASSERT(cache.insert(b0, e));
+  TEST_ASSERT(!cache.insert(b1, e));
+  TEST_EQUALITY(cache.bytes(), 3 * entry_bytes);
+
+  // Without a budget nothing is stored
+  cache.clear(&disc_b);
+  TEST_ASSERT(!cache.enabled(&disc_b));
+  TEST_ASSERT(cache.find(b0) == NULL);
+  TEST_ASSERT(!cache.insert(b0, e));
+  TEST_EQUALITY(cache.bytes(), 2 * entry_bytes);
+
+  cache.clear(&disc_a);
+  TEST_EQUALITY(cache.bytes(), 0u);
+}
+
+} // namespace
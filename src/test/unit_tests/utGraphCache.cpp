@@ -0,0 +1,91 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_Application.hpp"
+#include "Albany_Utils.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+
+const char input[] =
+  "<ParameterList>"
+  "  <ParameterList name=\"Problem\">"
+  "    <Parameter name=\"Name\" type=\"string\" value=\"Heat 2D\"/>"
+  "  </ParameterList>"
+  "  <ParameterList name=\"Discretization\">"
+  "    <Parameter name=\"1D Elements\" type=\"int\" value=\"8\"/>"
+  "    <Parameter name=\"2D Elements\" type=\"int\" value=\"6\"/>"
+  "    <Parameter name=\"Method\" type=\"string\" value=\"STK2D\"/>"
+  "    <Parameter name=\"Jacobian Graph Cache File\" type=\"string\" value=\"utGraphCache.graph\"/>"
+  "  </ParameterList>"
+  "</ParameterList>";
+
+std::string cacheFileName(const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  std::ostringstream ss;
+  ss << "utGraphCache.graph." << commT->getSize() << "." << commT->getRank();
+  return ss.str();
+}
+
+Teuchos::RCP<const Tpetra_CrsGraph>
+overlapGraph(const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  const Teuchos::RCP<Albany::Application> app =
+    Teuchos::rcp(new Albany::Application(commT, Teuchos::getParametersFromXmlString(input)));
+  return app->getDiscretization()->getOverlapJacobianGraphT();
+}
+
+// Same rows, column map and local columns
+void compareGraphs(const Tpetra_CrsGraph& a, const Tpetra_CrsGraph& b,
+                   Teuchos::FancyOStream& out, bool& success)
+{
+  TEST_ASSERT(a.isFillComplete());
+  TEST_ASSERT(b.isFillComplete());
+  TEST_COMPARE_ARRAYS(a.getRowMap()->getNodeElementList(), b.getRowMap()->getNodeElementList());
+  TEST_COMPARE_ARRAYS(a.getColMap()->getNodeElementList(), b.getColMap()->getNodeElementList());
+  TEST_EQUALITY(a.getNodeNumEntries(), b.getNodeNumEntries());
+  Teuchos::ArrayView<const LO> cols_a, cols_b;
+  for (std::size_t i = 0; i < a.getNodeNumRows(); ++i) {
+    a.getLocalRowView(i, cols_a);
+    b.getLocalRowView(i, cols_b);
+    TEST_COMPARE_ARRAYS(cols_a, cols_b);
+  }
+}
+
+TEUCHOS_UNIT_TEST(STKDiscretization, GraphCacheMatchesBuild)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  const std::string filename = cacheFileName(commT);
+  std::remove(filename.c_str());
+
+  // Built from the mesh and written
+  const Teuchos::RCP<const Tpetra_CrsGraph> built = overlapGraph(commT);
+  TEST_ASSERT(std::ifstream(filename.c_str()).good());
+
+  // Read back from the file
+  const Teuchos::RCP<const Tpetra_CrsGraph> cached = overlapGraph(commT);
+  compareGraphs(*built, *cached, out, success);
+
+  // A corrupt file is rebuilt from the mesh
+  {
+    std::ofstream os(filename.c_str(), std::ios::binary | std::ios::trunc);
+    os << "ALBGRAPH";
+  }
+  const Teuchos::RCP<const Tpetra_CrsGraph> rebuilt = overlapGraph(commT);
+  compareGraphs(*built, *rebuilt, out, success);
+
+  std::remove(filename.c_str());
+}
+
+} // namespace
@@ -0,0 +1,125 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_Application.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_Utils.hpp"
+
+#include <algorithm>
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/GetEntities.hpp>
+
+namespace
+{
+
+const char input[] =
+  "<ParameterList>"
+  "  <ParameterList name=\"Problem\">"
+  "    <Parameter name=\"Name\" type=\"string\" value=\"Heat 2D\"/>"
+  "  </ParameterList>"
+  "  <ParameterList name=\"Discretization\">"
+  "    <Parameter name=\"1D Elements\" type=\"int\" value=\"6\"/>"
+  "    <Parameter name=\"2D Elements\" type=\"int\" value=\"6\"/>"
+  "    <Parameter name=\"Method\" type=\"string\" value=\"STK2D\"/>"
+  "    <Parameter name=\"Incremental Graph Update\" type=\"bool\" value=\"true\"/>"
+  "  </ParameterList>"
+  "</ParameterList>";
+
+// Sorted global columns of every row of graph
+std::map<GO, std::vector<GO> >
+globalRows(const Tpetra_CrsGraph& graph)
+{
+  std::map<GO, std::vector<GO> > rows;
+  const Teuchos::RCP<const Tpetra_Map> rowMap = graph.getRowMap();
+  Teuchos::Array<GO> cols;
+  for (std::size_t i = 0; i < rowMap->getNodeNumElements(); ++i) {
+    const GO row = rowMap->getGlobalElement(i);
+    cols.resize(graph.getNumEntriesInGlobalRow(row));
+    size_t numEntries;
+    graph.getGlobalRowCopy(row, cols(), numEntries);
+    std::vector<GO>& sorted = rows[row];
+    sorted.assign(cols.begin(), cols.begin() + numEntries);
+    std::sort(sorted.begin(), sorted.end());
+  }
+  return rows;
+}
+
+// Detaches the first node of the first element onto a new node, as fracture
+// does when it splits a node
+void splitNode(Albany::AbstractSTKMeshStruct& meshStruct)
+{
+  stk::mesh::BulkData& bulkData = *meshStruct.bulkData;
+  std::vector<stk::mesh::Entity> elements, nodes;
+  stk::mesh::get_entities(bulkData, stk::topology::ELEMENT_RANK, elements);
+  stk::mesh::get_entities(bulkData, stk::topology::NODE_RANK, nodes);
+
+  stk::mesh::EntityId high_id = 0;
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    high_id = std::max(high_id, bulkData.identifier(nodes[i]));
+
+  bulkData.modification_begin();
+  const stk::mesh::Entity element = elements[0];
+  const stk::mesh::Entity old_node = bulkData.begin_nodes(element)[0];
+  const stk::mesh::ConnectivityOrdinal ordinal = bulkData.begin_node_ordinals(element)[0];
+  const stk::mesh::Entity new_node =
+    bulkData.declare_entity(stk::topology::NODE_RANK, high_id + 1, stk::mesh::PartVector());
+  bulkData.destroy_relation(element, old_node, ordinal);
+  bulkData.declare_relation(element, new_node, ordinal);
+
+  Albany::AbstractSTKFieldContainer::VectorFieldType* coordinates = meshStruct.getCoordinatesField();
+  const double* old_x = stk::mesh::field_data(*coordinates, old_node);
+  double* new_x = stk::mesh::field_data(*coordinates, new_node);
+  for (int i = 0; i < meshStruct.numDim; ++i)
+    new_x[i] = old_x[i];
+  bulkData.modification_end();
+}
+
+void compareGraphs(const Tpetra_CrsGraph& a, const Tpetra_CrsGraph& b,
+                   Teuchos::FancyOStream& out, bool& success)
+{
+  const std::map<GO, std::vector<GO> > rows_a = globalRows(a), rows_b = globalRows(b);
+  TEST_EQUALITY(rows_a.size(), rows_b.size());
+  for (std::map<GO, std::vector<GO> >::const_iterator it = rows_a.begin(); it != rows_a.end(); ++it) {
+    const std::map<GO, std::vector<GO> >::const_iterator jt = rows_b.find(it->first);
+    TEST_ASSERT(jt != rows_b.end());
+    if (jt != rows_b.end())
+      TEST_COMPARE_ARRAYS(it->second, jt->second);
+  }
+}
+
+TEUCHOS_UNIT_TEST(STKDiscretization, IncrementalGraphMatchesFullRebuild)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  if (commT->getSize() > 1) return;  // the mesh change below is serial
+
+  const Teuchos::RCP<Teuchos::ParameterList> params =
+    Teuchos::getParametersFromXmlString(input);
+  const Teuchos::RCP<Albany::Application> app =
+    Teuchos::rcp(new Albany::Application(commT, params));
+  const Teuchos::RCP<Albany::STKDiscretization> disc =
+    Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(app->getDiscretization(), true);
+
+  splitNode(*disc->getSTKMeshStruct());
+
+  // Incremental update from the graph of the original mesh
+  disc->updateMeshAfterTopologyChange();
+  const Teuchos::RCP<const Tpetra_CrsGraph> overlap_incremental = disc->getOverlapJacobianGraphT();
+  const Teuchos::RCP<const Tpetra_CrsGraph> owned_incremental = disc->getJacobianGraphT();
+
+  // Full rebuild of the same mesh
+  disc->updateMesh();
+  const Teuchos::RCP<const Tpetra_CrsGraph> overlap_full = disc->getOverlapJacobianGraphT();
+  const Teuchos::RCP<const Tpetra_CrsGraph> owned_full = disc->getJacobianGraphT();
+
+  TEST_ASSERT(overlap_incremental.get() != overlap_full.get());
+  compareGraphs(*overlap_incremental, *overlap_full, out, success);
+  compareGraphs(*owned_incremental, *owned_full, out, success);
+}
+
+} // namespace
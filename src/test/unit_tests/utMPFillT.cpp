@@ -0,0 +1,151 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_Application.hpp"
+#include "Albany_Utils.hpp"
+
+#include "Epetra_LocalMap.h"
+#include "Stokhos_ParallelData.hpp"
+#include "Stokhos_ProductEpetraVector.hpp"
+
+#include <cmath>
+#include <map>
+
+namespace
+{
+
+// Heat with a quadratic source, so the Jacobian of each member depends on
+// its solution
+const char input[] =
+  "<ParameterList>"
+  "  <ParameterList name=\"Problem\">"
+  "    <Parameter name=\"Name\" type=\"string\" value=\"Heat 2D\"/>"
+  "    <ParameterList name=\"Dirichlet BCs\">"
+  "      <Parameter name=\"DBC on NS NodeSet0 for DOF T\" type=\"double\" value=\"1.5\"/>"
+  "      <Parameter name=\"DBC on NS NodeSet1 for DOF T\" type=\"double\" value=\"1.0\"/>"
+  "    </ParameterList>"
+  "    <ParameterList name=\"Source Functions\">"
+  "      <ParameterList name=\"Quadratic\">"
+  "        <Parameter name=\"Nonlinear Factor\" type=\"double\" value=\"0.25\"/>"
+  "      </ParameterList>"
+  "    </ParameterList>"
+  "  </ParameterList>"
+  "  <ParameterList name=\"Discretization\">"
+  "    <Parameter name=\"1D Elements\" type=\"int\" value=\"8\"/>"
+  "    <Parameter name=\"2D Elements\" type=\"int\" value=\"6\"/>"
+  "    <Parameter name=\"Method\" type=\"string\" value=\"STK2D\"/>"
+  "  </ParameterList>"
+  "</ParameterList>";
+
+const int nblock = ALBANY_ENSEMBLE_SIZE;
+
+// Solution of member i at global row gid
+double solution(const int i, const GO gid)
+{
+  return 1.0 + 0.1 * i + 0.01 * (gid % 13);
+}
+
+bool close(const double a, const double b)
+{
+  return std::abs(a - b) <= 1.0e-12 * (1.0 + std::abs(b));
+}
+
+// Global row of a Tpetra matrix, by column GID
+std::map<GO, double> rowT(const Tpetra_CrsMatrix& A, const GO row)
+{
+  Teuchos::Array<GO> cols(A.getNumEntriesInGlobalRow(row));
+  Teuchos::Array<ST> vals(cols.size());
+  std::size_t num;
+  A.getGlobalRowCopy(row, cols(), vals(), num);
+  std::map<GO, double> entries;
+  for (std::size_t k = 0; k < num; ++k)
+    entries[cols[k]] = vals[k];
+  return entries;
+}
+
+// Global row of an Epetra matrix, by column GID
+std::map<GO, double> rowE(const Epetra_CrsMatrix& A, const int row)
+{
+  std::vector<int> cols(A.NumGlobalEntries(row));
+  std::vector<double> vals(cols.size());
+  int num;
+  A.ExtractGlobalRowCopy(row, cols.size(), num, vals.data(), cols.data());
+  std::map<GO, double> entries;
+  for (int k = 0; k < num; ++k)
+    entries[cols[k]] = vals[k];
+  return entries;
+}
+
+TEUCHOS_UNIT_TEST(Application, MPFillTMatchesEpetra)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  const Teuchos::RCP<Albany::Application> app =
+    Teuchos::rcp(new Albany::Application(commT, Teuchos::getParametersFromXmlString(input)));
+  const Teuchos::RCP<Albany::AbstractDiscretization> disc = app->getDiscretization();
+
+  const Teuchos::Array<ParamVec> p;
+  const Teuchos::Array<int> mp_p_index;
+  const Teuchos::Array< Teuchos::Array<MPType> > mp_p_vals;
+
+  // Tpetra: one column and one matrix per member
+  const Teuchos::RCP<const Tpetra_Map> mapT = disc->getMapT();
+  Tpetra_MultiVector xT(mapT, nblock), fT(mapT, nblock), residualT(mapT, nblock);
+  for (std::size_t k = 0; k < mapT->getNodeNumElements(); ++k)
+    for (int i = 0; i < nblock; ++i)
+      xT.replaceLocalValue(k, i, solution(i, mapT->getGlobalElement(k)));
+  Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> > jacT(nblock);
+  for (int i = 0; i < nblock; ++i)
+    jacT[i] = Teuchos::rcp(new Tpetra_CrsMatrix(disc->getJacobianGraphT()));
+
+  app->computeGlobalMPJacobianT(0.0, 1.0, 0.0, 0.0, NULL, NULL, xT,
+                                p, mp_p_index, mp_p_vals, &fT, jacT);
+  app->computeGlobalMPResidualT(0.0, NULL, NULL, xT,
+                                p, mp_p_index, mp_p_vals, residualT);
+
+  // Epetra: the same members as a Stokhos product container
+  const Teuchos::RCP<const EpetraExt::MultiComm> productComm =
+    Stokhos::buildMultiComm(*Albany::createEpetraCommFromTeuchosComm(commT),
+                            nblock, commT->getSize());
+  const Teuchos::RCP<const Epetra_BlockMap> blockMap =
+    Teuchos::rcp(new Epetra_LocalMap(nblock, 0, productComm->TimeDomainComm()));
+  const Teuchos::RCP<const Epetra_Map> map = disc->getMap();
+  Stokhos::ProductEpetraVector x(blockMap, map, productComm), f(blockMap, map, productComm);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> jac(blockMap);
+  for (int i = 0; i < nblock; ++i) {
+    for (int k = 0; k < map->NumMyElements(); ++k)
+      x[i][k] = solution(i, map->GID(k));
+    jac.setCoeffPtr(i, Teuchos::rcp(new Epetra_CrsMatrix(Copy, *disc->getJacobianGraph())));
+  }
+
+  app->computeGlobalMPJacobian(0.0, 1.0, 0.0, 0.0, NULL, NULL, x,
+                               p, mp_p_index, mp_p_vals, &f, jac);
+
+  for (int i = 0; i < nblock; ++i) {
+    const Teuchos::ArrayRCP<const ST> fT_i = fT.getData(i);
+    const Teuchos::ArrayRCP<const ST> residualT_i = residualT.getData(i);
+    TEST_ASSERT(jacT[i]->isFillComplete());
+    for (int k = 0; k < map->NumMyElements(); ++k) {
+      TEST_EQUALITY(static_cast<GO>(map->GID(k)), mapT->getGlobalElement(k));
+      TEST_ASSERT(close(fT_i[k], f[i][k]));
+      TEST_ASSERT(close(residualT_i[k], f[i][k]));
+
+      const std::map<GO, double> entriesT = rowT(*jacT[i], mapT->getGlobalElement(k));
+      const std::map<GO, double> entries = rowE(jac[i], map->GID(k));
+      TEST_EQUALITY(entriesT.size(), entries.size());
+      for (std::map<GO, double>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        const std::map<GO, double>::const_iterator jt = entriesT.find(it->first);
+        TEST_ASSERT(jt != entriesT.end());
+        if (jt != entriesT.end())
+          TEST_ASSERT(close(jt->second, it->second));
+      }
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,80 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_Application.hpp"
+#include "Albany_MatrixFreeJacobianOpT.hpp"
+#include "Albany_Utils.hpp"
+
+namespace
+{
+
+// Steady nonlinear heat problem, so that the Jacobian depends on x
+const char input[] =
+  "<ParameterList>"
+  "  <ParameterList name=\"Problem\">"
+  "    <Parameter name=\"Name\" type=\"string\" value=\"Heat 2D\"/>"
+  "    <ParameterList name=\"Dirichlet BCs\">"
+  "      <Parameter name=\"DBC on NS NodeSet0 for DOF T\" type=\"double\" value=\"1.5\"/>"
+  "      <Parameter name=\"DBC on NS NodeSet1 for DOF T\" type=\"double\" value=\"1.0\"/>"
+  "    </ParameterList>"
+  "    <ParameterList name=\"Source Functions\">"
+  "      <ParameterList name=\"Quadratic\">"
+  "        <Parameter name=\"Nonlinear Factor\" type=\"double\" value=\"3.4\"/>"
+  "      </ParameterList>"
+  "    </ParameterList>"
+  "  </ParameterList>"
+  "  <ParameterList name=\"Discretization\">"
+  "    <Parameter name=\"1D Elements\" type=\"int\" value=\"8\"/>"
+  "    <Parameter name=\"2D Elements\" type=\"int\" value=\"8\"/>"
+  "    <Parameter name=\"Method\" type=\"string\" value=\"STK2D\"/>"
+  "  </ParameterList>"
+  "</ParameterList>";
+
+TEUCHOS_UNIT_TEST(MatrixFreeJacobianOpT, ApplyMatchesAssembledJacobian)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  const Teuchos::RCP<Teuchos::ParameterList> params =
+    Teuchos::getParametersFromXmlString(input);
+  const Teuchos::RCP<Albany::Application> app =
+    Teuchos::rcp(new Albany::Application(commT, params));
+
+  // Evaluate away from the initial guess
+  const Teuchos::RCP<Tpetra_Vector> x =
+    Teuchos::rcp(new Tpetra_Vector(app->getMapT()));
+  x->randomize();
+  const Teuchos::RCP<Teuchos::Array<ParamVec> > p =
+    Teuchos::rcp(new Teuchos::Array<ParamVec>);
+  const double alpha = 0.0, beta = 1.0, omega = 0.0, time = 0.0;
+
+  Tpetra_CrsMatrix J(app->getJacobianGraphT());
+  app->computeGlobalJacobianT(alpha, beta, omega, time, NULL, NULL, *x, *p,
+                              NULL, J);
+
+  Albany::MatrixFreeJacobianOpT W(app);
+  W.set(alpha, beta, omega, time, Teuchos::null, Teuchos::null, x, p);
+
+  const int num_vecs = 3;
+  Tpetra_MultiVector V(app->getMapT(), num_vecs);
+  V.randomize();
+  Tpetra_MultiVector JV(app->getMapT(), num_vecs), WV(app->getMapT(), num_vecs);
+  J.apply(V, JV);
+  W.apply(V, WV);
+
+  // W*V - J*V must vanish up to round-off
+  Teuchos::Array<ST> norm_JV(num_vecs), norm_diff(num_vecs);
+  JV.normInf(norm_JV());
+  WV.update(-1.0, JV, 1.0);
+  WV.normInf(norm_diff());
+  for (int i = 0; i < num_vecs; ++i) {
+    TEST_COMPARE(norm_JV[i], >, 0.0);
+    TEST_COMPARE(norm_diff[i], <=, 1.0e-12 * norm_JV[i]);
+  }
+}
+
+} // namespace
@@ -0,0 +1,161 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Albany_SGBlockExporter.hpp"
+#include "Albany_Utils.hpp"
+
+#include "Epetra_CrsGraph.h"
+#include "Epetra_LocalMap.h"
+#include "Epetra_Map.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+const int num_blocks = 3;
+
+// 1D chain of rows_per_proc rows per process. The overlapped rows add the
+// first row of the next process, as an element on the process boundary does.
+struct Chain
+{
+  Teuchos::RCP<const Epetra_Comm> comm;
+  Teuchos::RCP<Epetra_Map> ownedMap, overlapMap;
+  Teuchos::RCP<Epetra_CrsGraph> ownedGraph, overlapGraph;
+  Teuchos::RCP<Epetra_Export> exporter;
+
+  Chain(const Teuchos::RCP<const Epetra_Comm>& comm_, const int rows_per_proc) :
+    comm(comm_)
+  {
+    const int num_global = rows_per_proc * comm->NumProc();
+    ownedMap = Teuchos::rcp(new Epetra_Map(num_global, 0, *comm));
+    std::vector<int> gids(ownedMap->MyGlobalElements(),
+                          ownedMap->MyGlobalElements() + ownedMap->NumMyElements());
+    if (ownedMap->MaxMyGID() + 1 < num_global)
+      gids.push_back(ownedMap->MaxMyGID() + 1);
+    overlapMap = Teuchos::rcp(new Epetra_Map(-1, gids.size(), &gids[0], 0, *comm));
+
+    ownedGraph = tridiagonal(*ownedMap, num_global);
+    overlapGraph = tridiagonal(*overlapMap, num_global);
+    exporter = Teuchos::rcp(new Epetra_Export(*overlapMap, *ownedMap));
+  }
+
+  Teuchos::RCP<Epetra_CrsGraph>
+  tridiagonal(const Epetra_Map& rowMap, const int num_global) const
+  {
+    const Teuchos::RCP<Epetra_CrsGraph> g = Teuchos::rcp(new Epetra_CrsGraph(Copy, rowMap, 3));
+    for (int k = 0; k < rowMap.NumMyElements(); ++k) {
+      const int row = rowMap.GID(k);
+      std::vector<int> cols(1, row);
+      if (row > 0) cols.push_back(row - 1);
+      if (row + 1 < num_global) cols.push_back(row + 1);
+      g->InsertGlobalIndices(row, cols.size(), &cols[0]);
+    }
+    g->FillComplete(*ownedMap, *ownedMap);
+    return g;
+  }
+
+  // num_blocks filled matrices on graph, with values depending on the block,
+  // row and column
+  Stokhos::ProductContainer<Epetra_CrsMatrix>
+  blocks(const Epetra_CrsGraph& graph, const double scale) const
+  {
+    Stokhos::ProductContainer<Epetra_CrsMatrix> c(
+        Teuchos::rcp(new Epetra_LocalMap(num_blocks, 0, *comm)));
+    for (int i = 0; i < num_blocks; ++i) {
+      const Teuchos::RCP<Epetra_CrsMatrix> A = Teuchos::rcp(new Epetra_CrsMatrix(Copy, graph));
+      A->FillComplete(graph.DomainMap(), graph.RangeMap());
+      for (int r = 0; r < A->NumMyRows(); ++r) {
+        int num;
+        double* values;
+        int* indices;
+        A->ExtractMyRowView(r, num, values, indices);
+        for (int k = 0; k < num; ++k)
+          values[k] = scale * (i + 1) + 0.1 * A->GRID(r) + 0.01 * A->GCID(indices[k]);
+      }
+      c.setCoeffPtr(i, A);
+    }
+    return c;
+  }
+};
+
+// Same values, in the same positions of the same graph
+void compareBlocks(const Stokhos::ProductContainer<Epetra_CrsMatrix>& a,
+                   const Stokhos::ProductContainer<Epetra_CrsMatrix>& b,
+                   Teuchos::FancyOStream& out, bool& success)
+{
+  TEST_EQUALITY(a.size(), b.size());
+  for (int i = 0; i < a.size(); ++i)
+    for (int r = 0; r < a[i].NumMyRows(); ++r) {
+      int num_a, num_b;
+      double *values_a, *values_b;
+      a[i].ExtractMyRowView(r, num_a, values_a);
+      b[i].ExtractMyRowView(r, num_b, values_b);
+      TEST_EQUALITY(num_a, num_b);
+      for (int k = 0; k < std::min(num_a, num_b); ++k)
+        TEST_FLOATING_EQUALITY(values_a[k], values_b[k], 1.0e-14);
+    }
+}
+
+// Reference: each block exported on its own
+void exportEach(Stokhos::ProductContainer<Epetra_CrsMatrix>& dst,
+                const Stokhos::ProductContainer<Epetra_CrsMatrix>& src,
+                const Epetra_Export& exporter)
+{
+  for (int i = 0; i < dst.size(); ++i) {
+    dst[i].PutScalar(0.0);
+    dst[i].Export(src[i], exporter, Add);
+  }
+}
+
+TEUCHOS_UNIT_TEST(SGBlockExporter, StackedExportMatchesBlockExport)
+{
+  const Teuchos::RCP<const Epetra_Comm> comm =
+    Albany::createEpetraCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  const Chain chain(comm, 5);
+
+  const Stokhos::ProductContainer<Epetra_CrsMatrix> src = chain.blocks(*chain.overlapGraph, 1.0);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> stacked = chain.blocks(*chain.ownedGraph, 7.0);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> unstacked = chain.blocks(*chain.ownedGraph, 7.0);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> expected = chain.blocks(*chain.ownedGraph, 7.0);
+
+  Albany::SGBlockExporter exporter, blockExporter(false);
+  exporter.exportMatrices(stacked, src, *chain.exporter);
+  blockExporter.exportMatrices(unstacked, src, *chain.exporter);
+  exportEach(expected, src, *chain.exporter);
+  compareBlocks(stacked, expected, out, success);
+  compareBlocks(unstacked, expected, out, success);
+
+  // Again with the stacked matrices of the first export
+  exporter.exportMatrices(stacked, src, *chain.exporter);
+  compareBlocks(stacked, expected, out, success);
+}
+
+TEUCHOS_UNIT_TEST(SGBlockExporter, NewBlocksAreRestacked)
+{
+  const Teuchos::RCP<const Epetra_Comm> comm =
+    Albany::createEpetraCommFromMpiComm(Albany_MPI_COMM_WORLD);
+  Albany::SGBlockExporter exporter;
+
+  {
+    const Chain chain(comm, 5);
+    const Stokhos::ProductContainer<Epetra_CrsMatrix> src = chain.blocks(*chain.overlapGraph, 1.0);
+    Stokhos::ProductContainer<Epetra_CrsMatrix> dst = chain.blocks(*chain.ownedGraph, 0.0);
+    exporter.exportMatrices(dst, src, *chain.exporter);
+  }
+
+  // A different mesh, after the caller dropped the first blocks
+  const Chain chain(comm, 8);
+  const Stokhos::ProductContainer<Epetra_CrsMatrix> src = chain.blocks(*chain.overlapGraph, 2.0);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> dst = chain.blocks(*chain.ownedGraph, 0.0);
+  Stokhos::ProductContainer<Epetra_CrsMatrix> expected = chain.blocks(*chain.ownedGraph, 0.0);
+  exporter.exportMatrices(dst, src, *chain.exporter);
+  exportEach(expected, src, *chain.exporter);
+  compareBlocks(dst, expected, out, success);
+}
+
+} // namespace
@@ -0,0 +1,186 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include "Albany_SolverFactory.hpp"
+#include "Albany_Utils.hpp"
+#include "Albany_WarmStartSolverT.hpp"
+
+#include "Thyra_VectorStdOps.hpp"
+#include "Thyra_NonlinearSolver_NOX.hpp"
+#include "NOX_Solver_Generic.H"
+
+#include <cmath>
+#include <sstream>
+
+namespace
+{
+
+// Heat with a quadratic source, whose factor is the parameter; Newton
+// stops at a residual of 1e-10 or after maxIters iterations
+std::string input(const int maxIters)
+{
+  std::ostringstream ss;
+  ss <<
+    "<ParameterList>"
+    "  <ParameterList name=\"Problem\">"
+    "    <Parameter name=\"Name\" type=\"string\" value=\"Heat 2D\"/>"
+    "    <Parameter name=\"Solution Method\" type=\"string\" value=\"Steady\"/>"
+    "    <ParameterList name=\"Dirichlet BCs\">"
+    "      <Parameter name=\"DBC on NS NodeSet0 for DOF T\" type=\"double\" value=\"1.5\"/>"
+    "      <Parameter name=\"DBC on NS NodeSet1 for DOF T\" type=\"double\" value=\"1.0\"/>"
+    "    </ParameterList>"
+    "    <ParameterList name=\"Source Functions\">"
+    "      <ParameterList name=\"Quadratic\">"
+    "        <Parameter name=\"Nonlinear Factor\" type=\"double\" value=\"2.0\"/>"
+    "      </ParameterList>"
+    "    </ParameterList>"
+    "    <ParameterList name=\"Parameters\">"
+    "      <Parameter name=\"Number\" type=\"int\" value=\"1\"/>"
+    "      <Parameter name=\"Parameter 0\" type=\"string\" value=\"Quadratic Nonlinear Factor\"/>"
+    "    </ParameterList>"
+    "    <ParameterList name=\"Response Functions\">"
+    "      <Parameter name=\"Number\" type=\"int\" value=\"1\"/>"
+    "      <Parameter name=\"Response 0\" type=\"string\" value=\"Solution Average\"/>"
+    "    </ParameterList>"
+    "  </ParameterList>"
+    "  <ParameterList name=\"Discretization\">"
+    "    <Parameter name=\"1D Elements\" type=\"int\" value=\"10\"/>"
+    "    <Parameter name=\"2D Elements\" type=\"int\" value=\"10\"/>"
+    "    <Parameter name=\"Method\" type=\"string\" value=\"STK2D\"/>"
+    "  </ParameterList>"
+    "  <ParameterList name=\"Piro\">"
+    "    <ParameterList name=\"NOX\">"
+    "      <ParameterList name=\"Direction\">"
+    "        <Parameter name=\"Method\" type=\"string\" value=\"Newton\"/>"
+    "        <ParameterList name=\"Newton\">"
+    "          <ParameterList name=\"Stratimikos Linear Solver\">"
+    "            <ParameterList name=\"Stratimikos\">"
+    "              <Parameter name=\"Linear Solver Type\" type=\"string\" value=\"Belos\"/>"
+    "              <ParameterList name=\"Linear Solver Types\">"
+    "                <ParameterList name=\"Belos\">"
+    "                  <Parameter name=\"Solver Type\" type=\"string\" value=\"Block GMRES\"/>"
+    "                  <ParameterList name=\"Solver Types\">"
+    "                    <ParameterList name=\"Block GMRES\">"
+    "                      <Parameter name=\"Convergence Tolerance\" type=\"double\" value=\"1e-12\"/>"
+    "                      <Parameter name=\"Maximum Iterations\" type=\"int\" value=\"200\"/>"
+    "                      <Parameter name=\"Num Blocks\" type=\"int\" value=\"200\"/>"
+    "                    </ParameterList>"
+    "                  </ParameterList>"
+    "                </ParameterList>"
+    "              </ParameterList>"
+    "              <Parameter name=\"Preconditioner Type\" type=\"string\" value=\"Ifpack2\"/>"
+    "              <ParameterList name=\"Preconditioner Types\">"
+    "                <ParameterList name=\"Ifpack2\">"
+    "                  <Parameter name=\"Prec Type\" type=\"string\" value=\"ILUT\"/>"
+    "                </ParameterList>"
+    "              </ParameterList>"
+    "            </ParameterList>"
+    "          </ParameterList>"
+    "        </ParameterList>"
+    "      </ParameterList>"
+    "      <ParameterList name=\"Line Search\">"
+    "        <Parameter name=\"Method\" type=\"string\" value=\"Full Step\"/>"
+    "      </ParameterList>"
+    "      <Parameter name=\"Nonlinear Solver\" type=\"string\" value=\"Line Search Based\"/>"
+    "      <ParameterList name=\"Status Tests\">"
+    "        <Parameter name=\"Test Type\" type=\"string\" value=\"Combo\"/>"
+    "        <Parameter name=\"Combo Type\" type=\"string\" value=\"OR\"/>"
+    "        <Parameter name=\"Number of Tests\" type=\"int\" value=\"2\"/>"
+    "        <ParameterList name=\"Test 0\">"
+    "          <Parameter name=\"Test Type\" type=\"string\" value=\"NormF\"/>"
+    "          <Parameter name=\"Tolerance\" type=\"double\" value=\"1e-10\"/>"
+    "        </ParameterList>"
+    "        <ParameterList name=\"Test 1\">"
+    "          <Parameter name=\"Test Type\" type=\"string\" value=\"MaxIters\"/>"
+    "          <Parameter name=\"Maximum Iterations\" type=\"int\" value=\"" << maxIters << "\"/>"
+    "        </ParameterList>"
+    "      </ParameterList>"
+    "    </ParameterList>"
+    "  </ParameterList>"
+    "</ParameterList>";
+  return ss.str();
+}
+
+// An Albany steady solve, warm started or not
+struct Solve
+{
+  Teuchos::RCP<Albany::SolverFactory> factory;
+  Teuchos::RCP<Albany::Application> app;
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > nox;
+  Teuchos::RCP<Albany::WarmStartSolverT> warm;
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > solver;
+
+  Solve(const Teuchos::RCP<const Teuchos_Comm>& commT, const int maxIters, const bool warmStart)
+  {
+    factory = Teuchos::rcp(new Albany::SolverFactory(
+        Teuchos::getParametersFromXmlString(input(maxIters)), commT));
+    nox = factory->createAndGetAlbanyAppT(app, commT, commT);
+    solver = nox;
+    if (warmStart) {
+      Teuchos::ParameterList dakotaParams;
+      dakotaParams.set("Warm Start", true);
+      warm = Teuchos::rcp(new Albany::WarmStartSolverT(nox, app, dakotaParams));
+      solver = warm;
+    }
+  }
+
+  // Solution average for the source factor
+  double solve(const double factor)
+  {
+    Thyra::ModelEvaluatorBase::InArgs<ST> inArgs = solver->createInArgs();
+    const Teuchos::RCP<Thyra::VectorBase<ST> > p = Thyra::createMember(solver->get_p_space(0));
+    Thyra::put_scalar(factor, p.ptr());
+    inArgs.set_p(0, p);
+    Thyra::ModelEvaluatorBase::OutArgs<ST> outArgs = solver->createOutArgs();
+    const Teuchos::RCP<Thyra::VectorBase<ST> > g = Thyra::createMember(solver->get_g_space(0));
+    outArgs.set_g(0, g);
+    solver->evalModel(inArgs, outArgs);
+    return Thyra::get_ele(*g, 0);
+  }
+
+  const NOX::Solver::Generic& noxSolver() const
+  {
+    return *Teuchos::rcp_dynamic_cast<Piro::NOXSolver<ST> >(nox, true)->getSolver()->getNOXSolver();
+  }
+};
+
+TEUCHOS_UNIT_TEST(WarmStartSolverT, WarmStartMatchesColdStart)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  // Second sample of a parameter study, seeded by the first
+  Solve warm(commT, 20, true);
+  warm.solve(2.0);
+  TEST_EQUALITY(warm.warm->getHistorySize(), 1u);
+  const double warmAverage = warm.solve(2.1);
+  const int warmIters = warm.noxSolver().getNumIterations();
+  TEST_EQUALITY(warm.warm->getHistorySize(), 2u);
+
+  // The same sample from the nominal guess
+  Solve cold(commT, 20, false);
+  const double coldAverage = cold.solve(2.1);
+  const int coldIters = cold.noxSolver().getNumIterations();
+
+  TEST_COMPARE(std::abs(warmAverage - coldAverage), <=, 1.0e-8 * std::abs(coldAverage));
+  TEST_COMPARE(warmIters, <, coldIters);
+}
+
+TEUCHOS_UNIT_TEST(WarmStartSolverT, UnconvergedSolveIsNotStored)
+{
+  const Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  // One Newton step does not reach the tolerance
+  Solve warm(commT, 1, true);
+  warm.solve(2.0);
+  TEST_INEQUALITY(warm.noxSolver().getStatus(), NOX::StatusTest::Converged);
+  TEST_EQUALITY(warm.warm->getHistorySize(), 0u);
+}
+
+} // namespace
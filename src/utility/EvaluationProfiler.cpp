@@ -0,0 +1,236 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#include "EvaluationProfiler.hpp"
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_Time.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <sstream>
+
+namespace util {
+
+namespace {
+
+string jsonString (const string& s) {
+  string out("\"");
+  for (const char c : s) {
+    if (c == '"' || c == '\\') out += '\\';
+    if (c == '\n') { out += "\\n"; continue; }
+    out += c;
+  }
+  return out + "\"";
+}
+
+// Union over all ranks of the keys recorded on each rank.
+std::vector<string> globalKeys (const Teuchos::Comm<int>& comm,
+                                const std::vector<string>& keys) {
+  string local;
+  for (const string& key : keys) local += key + '\n';
+
+  int localLength = local.size(), maxLength = 0;
+  Teuchos::reduceAll<int, int>(comm, Teuchos::REDUCE_MAX, 1, &localLength,
+                               &maxLength);
+  if (maxLength == 0) return std::vector<string>();
+
+  std::vector<char> send(maxLength, '\0'), recv(maxLength * comm.getSize());
+  std::copy(local.begin(), local.end(), send.begin());
+  Teuchos::gatherAll<int, char>(comm, maxLength, &send[0],
+                                maxLength * comm.getSize(), &recv[0]);
+
+  std::set<string> all;
+  string key;
+  for (const char c : recv) {
+    if (c == '\n') { all.insert(key); key.clear(); }
+    else if (c != '\0') key += c;
+  }
+  return std::vector<string>(all.begin(), all.end());
+}
+
+}
+
+EvaluationProfiler EvaluationProfiler::instance_ = EvaluationProfiler();
+
+EvaluationProfiler& EvaluationProfiler::instance () {
+  // Static object lifetime
+  return instance_;
+}
+
+EvaluationProfiler::EvaluationProfiler ()
+    : enabled_(false), summaryFile_("albany_profile.json"),
+      traceFile_("albany_trace.json"), maxTraceEvents_(100000), origin_(0) {
+}
+
+void EvaluationProfiler::setup (Teuchos::ParameterList& debugParams) {
+  enabled_ = debugParams.get<bool>("Profile Evaluations", false);
+  summaryFile_ = debugParams.get<string>("Profile Summary File", summaryFile_);
+  traceFile_ = debugParams.get<string>("Profile Trace File", traceFile_);
+  maxTraceEvents_ = debugParams.get<int>("Profile Maximum Trace Events",
+                                         static_cast<int>(maxTraceEvents_));
+  if (enabled_ && origin_ == 0) origin_ = Teuchos::Time::wallTime();
+}
+
+void EvaluationProfiler::record (
+    const char* evalType, const string& block, const int workset,
+    const double start, const double elapsed,
+    const std::size_t numCells, const int derivDim) {
+  const string key = string(evalType) + '|' + block;
+  auto pos = keyIndex_.find(key);
+  if (pos == keyIndex_.end()) {
+    pos = keyIndex_.insert(std::make_pair(key, static_cast<int>(keys_.size()))).first;
+    keys_.push_back(key);
+    stats_.push_back(Stats());
+  }
+
+  Stats& stats = stats_[pos->second];
+  ++stats.calls;
+  stats.cells += numCells;
+  stats.derivDim = std::max(stats.derivDim, derivDim);
+  stats.time += elapsed;
+
+  if (events_.size() < maxTraceEvents_) {
+    Event event = { pos->second, workset, numCells, start - origin_, elapsed };
+    events_.push_back(event);
+  }
+}
+
+void EvaluationProfiler::write (const Teuchos::Comm<int>& comm) {
+  if (!enabled_) return;
+  writeSummary(comm);
+  writeTrace(comm);
+}
+
+void EvaluationProfiler::writeSummary (const Teuchos::Comm<int>& comm) {
+  const std::vector<string> keys = globalKeys(comm, keys_);
+  const int n = keys.size();
+  const double inf = std::numeric_limits<double>::max();
+
+  // Per key: time (sum, min, max over the ranks that evaluated it), calls,
+  // cells and derivative dimension.
+  std::vector<double> time(n, 0), minTime(n, inf), maxTime(n, 0);
+  std::vector<double> counts(3 * n, 0);
+  for (int i = 0; i < n; ++i) {
+    const auto pos = keyIndex_.find(keys[i]);
+    if (pos == keyIndex_.end()) continue;
+    const Stats& stats = stats_[pos->second];
+    time[i] = minTime[i] = maxTime[i] = stats.time;
+    counts[3*i] = stats.calls;
+    counts[3*i+1] = stats.cells;
+    counts[3*i+2] = stats.derivDim;
+  }
+
+  std::vector<double> gTime(n), gMinTime(n), gMaxTime(n), gCounts(3 * n),
+      gDerivDim(3 * n);
+  if (n > 0) {
+    Teuchos::reduceAll<int, double>(comm, Teuchos::REDUCE_SUM, n, &time[0], &gTime[0]);
+    Teuchos::reduceAll<int, double>(comm, Teuchos::REDUCE_MIN, n, &minTime[0], &gMinTime[0]);
+    Teuchos::reduceAll<int, double>(comm, Teuchos::REDUCE_MAX, n, &maxTime[0], &gMaxTime[0]);
+    Teuchos::reduceAll<int, double>(comm, Teuchos::REDUCE_SUM, 3 * n, &counts[0], &gCounts[0]);
+    Teuchos::reduceAll<int, double>(comm, Teuchos::REDUCE_MAX, 3 * n, &counts[0], &gDerivDim[0]);
+  }
+
+  // All Teuchos timers, including the per-evaluator Phalanx timers if any.
+  Teuchos::TimeMonitor::stat_map_type timerStats;
+  std::vector<string> statNames;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(
+      timerStats, statNames, Teuchos::ptrFromRef(comm), Teuchos::Union);
+
+  if (comm.getRank() != 0) return;
+
+  // Hottest first
+  std::vector<int> order(n);
+  for (int i = 0; i < n; ++i) order[i] = i;
+  std::sort(order.begin(), order.end(),
+            [&](int a, int b) { return gMaxTime[a] > gMaxTime[b]; });
+
+  std::ofstream out(summaryFile_.c_str());
+  out << "{\n  \"number of ranks\": " << comm.getSize() << ",\n";
+  out << "  \"evaluations\": [";
+  for (int j = 0; j < n; ++j) {
+    const int i = order[j];
+    const std::size_t sep = keys[i].find('|');
+    const double cells = gCounts[3*i+1];
+    out << (j ? ",\n" : "\n")
+        << "    {\"evaluation type\": " << jsonString(keys[i].substr(0, sep))
+        << ", \"element block\": " << jsonString(keys[i].substr(sep + 1))
+        << ", \"calls\": " << static_cast<std::size_t>(gCounts[3*i])
+        << ", \"cells\": " << static_cast<std::size_t>(cells)
+        << ", \"derivative dimension\": " << static_cast<int>(gDerivDim[3*i+2])
+        << ", \"total time\": " << gTime[i]
+        << ", \"min rank time\": " << gMinTime[i]
+        << ", \"mean rank time\": " << gTime[i] / comm.getSize()
+        << ", \"max rank time\": " << gMaxTime[i]
+        << ", \"time per cell\": " << (cells > 0 ? gTime[i] / cells : 0.0)
+        << "}";
+  }
+  out << "\n  ],\n";
+
+  out << "  \"timers\": [";
+  bool first = true;
+  for (const auto& timer : timerStats) {
+    out << (first ? "\n" : ",\n") << "    {\"name\": " << jsonString(timer.first);
+    for (std::size_t k = 0; k < statNames.size() && k < timer.second.size(); ++k)
+      out << ", " << jsonString(statNames[k]) << ": " << timer.second[k].first;
+    out << "}";
+    first = false;
+  }
+  out << "\n  ]\n}\n";
+}
+
+void EvaluationProfiler::writeTrace (const Teuchos::Comm<int>& comm) {
+  // One file per rank; the rank is the trace process id.
+  const int rank = comm.getRank();
+  string filename = traceFile_;
+  if (comm.getSize() > 1) {
+    std::ostringstream ss;
+    ss << traceFile_ << "." << rank;
+    filename = ss.str();
+  }
+
+  std::ofstream out(filename.c_str());
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for (std::size_t i = 0; i < events_.size(); ++i) {
+    const Event& e = events_[i];
+    const string& key = keys_[e.key];
+    const std::size_t sep = key.find('|');
+    out << (i ? ",\n" : "\n")
+        << "{\"name\": " << jsonString(key.substr(sep + 1))
+        << ", \"cat\": " << jsonString(key.substr(0, sep))
+        << ", \"ph\": \"X\", \"pid\": " << rank << ", \"tid\": 0"
+        << ", \"ts\": " << e.start * 1.0e6 << ", \"dur\": " << e.elapsed * 1.0e6
+        << ", \"args\": {\"workset\": " << e.workset
+        << ", \"cells\": " << e.numCells
+        << ", \"derivative dimension\": " << stats_[e.key].derivDim << "}}";
+  }
+  out << "\n]}\n";
+}
+
+EvaluationProfiler::Scope::Scope (
+    const char* evalType, const string& block, const int workset,
+    const std::size_t numCells, const int derivDim)
+    : evalType_(evalType), workset_(workset),
+      numCells_(numCells), derivDim_(derivDim), start_(-1) {
+  if (EvaluationProfiler::instance().enabled()) {
+    block_ = block;
+    start_ = Teuchos::Time::wallTime();
+  }
+}
+
+EvaluationProfiler::Scope::~Scope () {
+  if (start_ < 0) return;
+  const double elapsed = Teuchos::Time::wallTime() - start_;
+  EvaluationProfiler::instance().record(evalType_, block_, workset_, start_,
+                                        elapsed, numCells_, derivDim_);
+}
+
+}
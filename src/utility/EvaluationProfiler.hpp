@@ -0,0 +1,116 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_EVALUATIONPROFILER_HPP
+#define UTIL_EVALUATIONPROFILER_HPP
+
+/**
+ *  \file EvaluationProfiler.hpp
+ *
+ *  \brief Opt-in profiling of the Phalanx evaluations of each fill.
+ */
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_ParameterList.hpp>
+
+#include <map>
+#include <vector>
+
+#include "string.hpp"
+
+namespace util {
+
+/**
+ *  \brief Times the field manager evaluations per evaluation type, element
+ *         block and workset.
+ *
+ *  Enabled through the "Debug Output" list:
+ *  \code
+ *    <ParameterList name="Debug Output">
+ *      <Parameter name="Profile Evaluations" type="bool" value="true"/>
+ *      <Parameter name="Profile Summary File" type="string" value="albany_profile.json"/>
+ *      <Parameter name="Profile Trace File" type="string" value="albany_trace.json"/>
+ *      <Parameter name="Profile Maximum Trace Events" type="int" value="100000"/>
+ *    </ParameterList>
+ *  \endcode
+ *
+ *  write() aggregates the records across ranks into a JSON summary, together
+ *  with the global statistics of all Teuchos timers (which include one timer
+ *  per evaluator when Phalanx is built with its Teuchos time monitors), and
+ *  writes the events of each rank to a Chrome trace file (chrome://tracing).
+ */
+class EvaluationProfiler {
+public:
+
+  static EvaluationProfiler& instance();
+
+  //! Read the profiling options from the "Debug Output" list.
+  void setup(Teuchos::ParameterList& debugParams);
+
+  bool enabled () const { return enabled_; }
+
+  //! Record one evaluation that started at \c start and took \c elapsed seconds.
+  void record(const char* evalType, const string& block, const int workset,
+              const double start, const double elapsed,
+              const std::size_t numCells, const int derivDim);
+
+  //! Write the summary and trace files. Collective; no-op if not enabled.
+  void write(const Teuchos::Comm<int>& comm);
+
+  //! Times its own lifetime and records it.
+  class Scope {
+  public:
+    Scope(const char* evalType, const string& block, const int workset,
+          const std::size_t numCells, const int derivDim);
+    ~Scope();
+  private:
+    const char* evalType_;
+    //! A copy, so that temporary block names can be passed
+    string block_;
+    const int workset_;
+    const std::size_t numCells_;
+    const int derivDim_;
+    double start_;
+  };
+
+private:
+
+  EvaluationProfiler();
+
+  struct Stats {
+    Stats() : calls(0), cells(0), derivDim(0), time(0) {}
+    std::size_t calls, cells;
+    int derivDim;
+    double time;
+  };
+
+  struct Event {
+    int key, workset;
+    std::size_t numCells;
+    double start, elapsed;
+  };
+
+  static EvaluationProfiler instance_;
+
+  bool enabled_;
+  string summaryFile_, traceFile_;
+  std::size_t maxTraceEvents_;
+  double origin_;
+
+  std::map<string, int> keyIndex_;
+  std::vector<string> keys_;
+  std::vector<Stats> stats_;
+  std::vector<Event> events_;
+
+  void writeSummary(const Teuchos::Comm<int>& comm);
+  void writeTrace(const Teuchos::Comm<int>& comm);
+};
+
+}
+
+#endif  // UTIL_EVALUATIONPROFILER_HPP